@@ -0,0 +1,127 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include <variable.h>
+
+#include "julia_convert.h"
+#include "julia_executor.h"
+#include "julia_gc.h"
+
+namespace philote {
+namespace julia {
+namespace bench {
+
+namespace {
+
+// The previous GCProtect: roots copied into a std::vector on every scope.
+// The frame header lives in the vector too, so the baseline stays sound.
+class VectorGCProtect {
+public:
+    explicit VectorGCProtect(std::initializer_list<jl_value_t*> objs)
+        : frame_(2 + objs.size()) {
+        frame_[0] = reinterpret_cast<void*>(JL_GC_ENCODE_PUSHARGS(objs.size()));
+        frame_[1] = jl_pgcstack;
+        std::copy(objs.begin(), objs.end(), frame_.begin() + 2);
+        jl_pgcstack = reinterpret_cast<jl_gcframe_t*>(frame_.data());
+    }
+
+    ~VectorGCProtect() {
+        jl_pgcstack = static_cast<jl_gcframe_t*>(frame_[1]);
+    }
+
+private:
+    std::vector<void*> frame_;
+};
+
+// Globally rooted Julia object to protect over and over
+jl_value_t* Value() {
+    return jl_eval_string("global bench_gc_value = Ref(0.0)");
+}
+
+// n scalar variables, as for a discipline of many small inputs
+philote::Variables ScalarVariables(int64_t n) {
+    philote::Variables vars;
+    for (int64_t i = 0; i < n; ++i) {
+        vars["x" + std::to_string(i)] = philote::Variable(philote::kInput, {1});
+    }
+    return vars;
+}
+
+}  // namespace
+
+// One protection scope of 4 roots per iteration, with the roots copied
+// into a heap-allocated vector
+static void BM_GCProtectVector(benchmark::State& state) {
+    JuliaExecutor::GetInstance().Submit([&state]() {
+        jl_value_t* value = Value();
+        for (auto _ : state) {
+            VectorGCProtect protect({value, value, value, value});
+            benchmark::ClobberMemory();
+        }
+    });
+}
+BENCHMARK(BM_GCProtectVector);
+
+// The same with GCProtect, whose frame is inline up to kInlineRoots
+static void BM_GCProtect(benchmark::State& state) {
+    JuliaExecutor::GetInstance().Submit([&state]() {
+        jl_value_t* value = Value();
+        for (auto _ : state) {
+            GCProtect protect({value, value, value, value});
+            benchmark::ClobberMemory();
+        }
+    });
+}
+BENCHMARK(BM_GCProtect);
+
+// The same with a GCFrame<4>
+static void BM_GCFrame(benchmark::State& state) {
+    JuliaExecutor::GetInstance().Submit([&state]() {
+        jl_value_t* value = Value();
+        for (auto _ : state) {
+            GCFrame<4> frame(value, value, value, value);
+            benchmark::ClobberMemory();
+        }
+    });
+}
+BENCHMARK(BM_GCFrame);
+
+// A frame of one root per variable, from the thread's arena
+static void BM_GCArenaFrame(benchmark::State& state) {
+    size_t n = static_cast<size_t>(state.range(0));
+    JuliaExecutor::GetInstance().Submit([&state, n]() {
+        jl_value_t* value = Value();
+        for (auto _ : state) {
+            GCArenaFrame frame(n);
+            for (size_t i = 0; i < n; ++i) {
+                frame.Set(i, value);
+            }
+            benchmark::ClobberMemory();
+        }
+    });
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GCArenaFrame)->ArgName("roots")->Arg(200)->Arg(5000);
+
+// Converting 200 scalar inputs: every temporary is rooted in one GCFrame
+static void BM_VariablesToJuliaDict(benchmark::State& state) {
+    philote::Variables vars = ScalarVariables(state.range(0));
+    JuliaExecutor::GetInstance().Submit([&state, &vars]() {
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(VariablesToJuliaDict(vars));
+        }
+    });
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VariablesToJuliaDict)->ArgName("variables")->Arg(200);
+
+}  // namespace bench
+}  // namespace julia
+}  // namespace philote
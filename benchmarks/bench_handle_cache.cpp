@@ -0,0 +1,88 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include <variable.h>
+
+#include "julia_config.h"
+#include "julia_executor.h"
+#include "julia_explicit_discipline.h"
+#include "julia_runtime.h"
+
+namespace philote {
+namespace julia {
+namespace bench {
+
+// The type and function lookups one scalar compute() used to repeat on
+// every call (input dict type, setindex!, compute in Main, and the
+// keys/collect/getindex used to read the result back), resolved either by
+// name as before (arg 0) or through the runtime's handle cache (arg 1).
+static void BM_HandleLookups(benchmark::State& state) {
+    bool cached = state.range(0) != 0;
+    JuliaExecutor::GetInstance().Submit([&state, cached]() {
+        JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+        jl_value_t* float64 = reinterpret_cast<jl_value_t*>(jl_float64_type);
+        for (auto _ : state) {
+            if (cached) {
+                benchmark::DoNotOptimize(handles.dict_string_vector_type);
+                benchmark::DoNotOptimize(handles.setindex_fn);
+                benchmark::DoNotOptimize(handles.MainFunction("compute"));
+                benchmark::DoNotOptimize(handles.keys_fn);
+                benchmark::DoNotOptimize(handles.collect_fn);
+                benchmark::DoNotOptimize(handles.getindex_fn);
+            } else {
+                jl_value_t* dict_type =
+                    jl_get_global(jl_base_module, jl_symbol("Dict"));
+                jl_value_t* params[2] = {
+                    reinterpret_cast<jl_value_t*>(jl_string_type),
+                    jl_apply_array_type(float64, 1)};
+                benchmark::DoNotOptimize(jl_apply_type(dict_type, params, 2));
+                benchmark::DoNotOptimize(
+                    jl_get_function(jl_base_module, "setindex!"));
+                benchmark::DoNotOptimize(
+                    jl_get_function(jl_main_module, "compute"));
+                benchmark::DoNotOptimize(jl_get_function(jl_base_module, "keys"));
+                benchmark::DoNotOptimize(
+                    jl_get_function(jl_base_module, "collect"));
+                benchmark::DoNotOptimize(
+                    jl_get_function(jl_base_module, "getindex"));
+            }
+        }
+    });
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HandleLookups)->ArgName("cached")->Arg(0)->Arg(1);
+
+// Full scalar compute() through the executor (paraboloid: two scalar
+// inputs, one scalar output), for scale against the lookup savings
+static void BM_ScalarCompute(benchmark::State& state) {
+    static std::shared_ptr<JuliaExplicitDiscipline> discipline = []() {
+        DisciplineConfig config;
+        config.kind = "explicit";
+        config.julia_file =
+            std::string(PHILOTE_JULIA_TEST_DISCIPLINES_DIR) + "/paraboloid.jl";
+        config.julia_type = "ParaboloidDiscipline";
+        return std::make_shared<JuliaExplicitDiscipline>(config);
+    }();
+
+    philote::Variables inputs;
+    inputs["x"] = philote::Variable(philote::kInput, {1});
+    inputs["y"] = philote::Variable(philote::kInput, {1});
+    inputs["x"](0) = 3.0;
+    inputs["y"](0) = 4.0;
+
+    for (auto _ : state) {
+        philote::Variables outputs = discipline->ComputeAsync(inputs).Get();
+        benchmark::DoNotOptimize(outputs);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ScalarCompute);
+
+}  // namespace bench
+}  // namespace julia
+}  // namespace philote
@@ -0,0 +1,28 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <benchmark/benchmark.h>
+
+#include "julia_executor.h"
+
+namespace philote {
+namespace julia {
+namespace bench {
+
+// Round trip of an empty task through the executor: enqueue, wake the
+// worker, run, and hand the result back to the blocked producer. Each
+// benchmark thread is one concurrent producer (a gRPC worker in production).
+static void BM_SubmitRoundTrip(benchmark::State& state) {
+    JuliaExecutor& executor = JuliaExecutor::GetInstance();
+    int value = 0;
+    for (auto _ : state) {
+        value = executor.Submit([value]() { return value + 1; });
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SubmitRoundTrip)->Threads(1)->Threads(8)->Threads(64)->UseRealTime();
+
+}  // namespace bench
+}  // namespace julia
+}  // namespace philote
@@ -0,0 +1,140 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "julia_kernels.h"
+#include "julia_layout.h"
+
+namespace philote {
+namespace julia {
+namespace bench {
+
+namespace {
+
+void SetLayoutCounters(benchmark::State& state, size_t size) {
+    // Every element is read once and written once
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(2 * size * sizeof(double)));
+}
+
+void RunRowMajorToColumnMajor(benchmark::State& state,
+                              const std::vector<size_t>& shape) {
+    size_t size = 1;
+    for (size_t dim : shape) {
+        size *= dim;
+    }
+    std::vector<double> src(size, 1.0);
+    std::vector<double> dst(size);
+
+    for (auto _ : state) {
+        RowMajorToColumnMajor(src.data(), dst.data(), shape);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    SetLayoutCounters(state, size);
+}
+
+void SquareMatrices(benchmark::internal::Benchmark* b) {
+    for (int64_t n : {8, 64, 256, 1024, 4096}) {
+        b->Args({n, n});
+    }
+}
+
+void RunArrayConverter3D(benchmark::State& state, ElementType type) {
+    std::vector<size_t> shape = {static_cast<size_t>(state.range(0)),
+                                 static_cast<size_t>(state.range(1)),
+                                 static_cast<size_t>(state.range(2))};
+    ArrayConverter converter(shape, ArrayLayout::kRowMajor, type);
+    std::vector<double> src(converter.size(), 1.0);
+    std::vector<char> dst(converter.size() * ElementSize(type));
+
+    for (auto _ : state) {
+        converter.ToJulia(src.data(), dst.data());
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    // Reads doubles, writes the Julia element type
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(converter.size()));
+    state.SetBytesProcessed(
+        state.iterations() *
+        static_cast<int64_t>(converter.size() *
+                             (sizeof(double) + ElementSize(type))));
+}
+
+void FieldShapes(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"d0", "d1", "d2"});
+    // Small blocks, where the per-call bookkeeping shows
+    b->Args({2, 3, 4});
+    b->Args({4, 4, 4});
+    b->Args({16, 16, 16});
+    b->Args({64, 64, 64});
+    b->Args({256, 256, 16});
+    b->Args({16, 256, 256});
+    b->Args({3, 512, 512});
+}
+
+}  // namespace
+
+// The element-by-element strided loop conversion used before the blocked
+// kernel, as a baseline (2-D only)
+static void BM_NaiveTranspose(benchmark::State& state) {
+    size_t rows = static_cast<size_t>(state.range(0));
+    size_t cols = static_cast<size_t>(state.range(1));
+    std::vector<double> src(rows * cols, 1.0);
+    std::vector<double> dst(rows * cols);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < cols; ++j) {
+                dst[j * rows + i] = src[i * cols + j];
+            }
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    SetLayoutCounters(state, rows * cols);
+}
+
+// Blocked SIMD conversion of one matrix variable, as done for every 2-D
+// input of a compute call
+static void BM_RowMajorToColumnMajor2D(benchmark::State& state) {
+    RunRowMajorToColumnMajor(state, {static_cast<size_t>(state.range(0)),
+                                     static_cast<size_t>(state.range(1))});
+}
+
+// Full axis permutation of a 3-D field variable
+static void BM_RowMajorToColumnMajor3D(benchmark::State& state) {
+    RunRowMajorToColumnMajor(state, {static_cast<size_t>(state.range(0)),
+                                     static_cast<size_t>(state.range(1)),
+                                     static_cast<size_t>(state.range(2))});
+}
+
+// The same permutation through a converter built once, as at setup: the
+// rank-3 kernel with no per-call shape scan or stride vectors
+static void BM_ArrayConverter3D(benchmark::State& state) {
+    RunArrayConverter3D(state, ElementType::kFloat64);
+}
+
+// Narrowing into a Float32 Julia array: half the bytes written, and half
+// the footprint for the discipline to read
+static void BM_ArrayConverterFloat32_3D(benchmark::State& state) {
+    RunArrayConverter3D(state, ElementType::kFloat32);
+}
+
+BENCHMARK(BM_NaiveTranspose)->ArgNames({"rows", "cols"})->Apply(SquareMatrices);
+BENCHMARK(BM_RowMajorToColumnMajor2D)
+    ->ArgNames({"rows", "cols"})
+    ->Apply(SquareMatrices);
+BENCHMARK(BM_RowMajorToColumnMajor3D)->Apply(FieldShapes);
+BENCHMARK(BM_ArrayConverter3D)->Apply(FieldShapes);
+BENCHMARK(BM_ArrayConverterFloat32_3D)->Apply(FieldShapes);
+
+}  // namespace bench
+}  // namespace julia
+}  // namespace philote
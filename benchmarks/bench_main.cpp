@@ -0,0 +1,27 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <benchmark/benchmark.h>
+
+#include "julia_executor.h"
+#include "julia_runtime.h"
+
+using philote::julia::JuliaExecutor;
+using philote::julia::JuliaRuntime;
+
+int main(int argc, char** argv) {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    // Initialize Julia and the executor once for all benchmarks
+    JuliaRuntime::GetInstance();
+    JuliaExecutor::GetInstance().Start();
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+
+    JuliaExecutor::GetInstance().Stop();
+    return 0;
+}
@@ -0,0 +1,60 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include <variable.h>
+
+#include "julia_config.h"
+#include "julia_executor.h"
+#include "julia_explicit_discipline.h"
+
+namespace philote {
+namespace julia {
+namespace bench {
+
+namespace {
+
+std::shared_ptr<JuliaExplicitDiscipline> LoadPackedParaboloid(bool native) {
+    DisciplineConfig config;
+    config.kind = "explicit";
+    config.julia_file = std::string(PHILOTE_JULIA_TEST_DISCIPLINES_DIR) +
+                        "/packed_paraboloid.jl";
+    config.julia_type = "PackedParaboloidDiscipline";
+    config.native_compute = native;
+    auto discipline = std::make_shared<JuliaExplicitDiscipline>(config);
+    // Builds the packed indexes (public through the Philote base class)
+    static_cast<philote::Discipline&>(*discipline).Setup();
+    return discipline;
+}
+
+}  // namespace
+
+// Scalar compute_packed! through the executor, called with jl_call
+// (native:0) or through the precompiled @cfunction pointer (native:1).
+// Compare with BM_ScalarCompute for the dict path.
+static void BM_PackedCompute(benchmark::State& state) {
+    static std::shared_ptr<JuliaExplicitDiscipline> disciplines[2] = {
+        LoadPackedParaboloid(false), LoadPackedParaboloid(true)};
+    JuliaExplicitDiscipline& discipline = *disciplines[state.range(0)];
+
+    philote::Variables inputs;
+    inputs["x"] = philote::Variable(philote::kInput, {1});
+    inputs["y"] = philote::Variable(philote::kInput, {1});
+    inputs["x"](0) = 3.0;
+    inputs["y"](0) = 4.0;
+
+    for (auto _ : state) {
+        philote::Variables outputs = discipline.ComputeAsync(inputs).Get();
+        benchmark::DoNotOptimize(outputs);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PackedCompute)->ArgName("native")->Arg(0)->Arg(1);
+
+}  // namespace bench
+}  // namespace julia
+}  // namespace philote
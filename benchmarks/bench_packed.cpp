@@ -0,0 +1,97 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <variable.h>
+
+#include "julia_convert.h"
+#include "julia_executor.h"
+#include "julia_gc.h"
+#include "julia_packed.h"
+#include "julia_runtime.h"
+
+namespace philote {
+namespace julia {
+namespace bench {
+
+namespace {
+
+// n scalar inputs x1..xn
+philote::Variables ScalarInputs(int64_t n) {
+    philote::Variables inputs;
+    for (int64_t i = 0; i < n; ++i) {
+        philote::Variable var(philote::kInput, {1});
+        var(0) = static_cast<double>(i);
+        inputs["x" + std::to_string(i + 1)] = var;
+    }
+    return inputs;
+}
+
+PackedIndex ScalarIndex(const philote::Variables& inputs) {
+    PackedIndex index;
+    for (const auto& [name, var] : inputs) {
+        PackedSlot slot;
+        slot.name = name;
+        slot.offset = index.size;
+        slot.size = 1;
+        slot.shape = {1};
+        slot.converter = ArrayConverter(slot.shape, slot.layout);
+        index.slots.push_back(slot);
+        index.size += 1;
+    }
+    return index;
+}
+
+}  // namespace
+
+// Building a fresh Dict{String,Vector{Float64}} of n scalar inputs: one
+// boxed key, array and setindex! per variable
+static void BM_ScalarInputsToDict(benchmark::State& state) {
+    philote::Variables inputs = ScalarInputs(state.range(0));
+    JuliaExecutor::GetInstance().Submit([&state, &inputs]() {
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(VariablesToJuliaDict(inputs));
+        }
+    });
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ScalarInputsToDict)->ArgName("inputs")->RangeMultiplier(8)->Range(8, 512);
+
+// Refreshing a persistent dict in place (reuse_input_dicts)
+static void BM_ScalarInputsToReusedDict(benchmark::State& state) {
+    philote::Variables inputs = ScalarInputs(state.range(0));
+    JuliaExecutor::GetInstance().Submit([&state, &inputs]() {
+        JuliaReusableDict cached;
+        GCProtect dict_protect(cached.Reset(inputs, false));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(cached.Update(inputs));
+        }
+    });
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ScalarInputsToReusedDict)->ArgName("inputs")->RangeMultiplier(8)->Range(8, 512);
+
+// Packing the same inputs into one persistent Vector{Float64}
+static void BM_ScalarInputsToPacked(benchmark::State& state) {
+    philote::Variables inputs = ScalarInputs(state.range(0));
+    PackedIndex index = ScalarIndex(inputs);
+    JuliaExecutor::GetInstance().Submit([&state, &inputs, &index]() {
+        jl_array_t* buffer = jl_alloc_array_1d(
+            JuliaRuntime::GetInstance().Handles().vector_float64_type,
+            index.size);
+        GCProtect buffer_protect(reinterpret_cast<jl_value_t*>(buffer));
+        for (auto _ : state) {
+            PackVariables(inputs, index, jl_array_data(buffer, double));
+            benchmark::ClobberMemory();
+        }
+    });
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ScalarInputsToPacked)->ArgName("inputs")->RangeMultiplier(8)->Range(8, 512);
+
+}  // namespace bench
+}  // namespace julia
+}  // namespace philote
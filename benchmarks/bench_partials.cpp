@@ -0,0 +1,83 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+
+#include <variable.h>
+
+#include "julia_convert.h"
+#include "julia_executor.h"
+#include "julia_partials.h"
+
+namespace philote {
+namespace julia {
+namespace bench {
+
+namespace {
+
+// Julia result of compute_partials() with n scalar blocks d(o<i>)/d(x),
+// either as a Dict keyed by "o<i>~x" or as a block-indexed Vector, bound to
+// a global in Main so it stays rooted
+jl_value_t* MakeResult(int64_t n, bool indexed) {
+    std::string name = indexed ? "bench_partials_blocks_" : "bench_partials_dict_";
+    name += std::to_string(n);
+    std::string code =
+        indexed ? "[[Float64(i)] for i in 1:" + std::to_string(n) + "]"
+                : "Dict(\"o$(i)~x\" => [Float64(i)] for i in 1:" +
+                      std::to_string(n) + ")";
+    return jl_eval_string(("global " + name + " = " + code).c_str());
+}
+
+PartialsBlockTable MakeTable(int64_t n) {
+    PartialsBlockTable table(static_cast<size_t>(n));
+    for (int64_t i = 0; i < n; ++i) {
+        table[i].key = {"o" + std::to_string(i + 1), "x"};
+        table[i].shape = {1, 1};
+        table[i].size = 1;
+        table[i].converter = ArrayConverter(table[i].shape, table[i].layout);
+    }
+    std::sort(table.begin(), table.end(),
+              [](const PartialsBlock& a, const PartialsBlock& b) {
+                  return a.key < b.key;
+              });
+    return table;
+}
+
+}  // namespace
+
+// Reading n scalar partials from a Dict with "output~input" keys: keys,
+// collect, one getindex and one key split per block
+static void BM_PartialsFromDict(benchmark::State& state) {
+    int64_t n = state.range(0);
+    JuliaExecutor::GetInstance().Submit([&state, n]() {
+        jl_value_t* result = MakeResult(n, false);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(JuliaDictToPartials(result));
+        }
+    });
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_PartialsFromDict)->ArgName("blocks")->RangeMultiplier(8)->Range(8, 512);
+
+// The same partials returned by block index: one array read per block
+static void BM_PartialsFromBlocks(benchmark::State& state) {
+    int64_t n = state.range(0);
+    PartialsBlockTable table = MakeTable(n);
+    JuliaExecutor::GetInstance().Submit([&state, &table, n]() {
+        jl_value_t* result = MakeResult(n, true);
+        SparsePartials sparse;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(
+                JuliaBlocksToPartials(result, table, sparse));
+        }
+    });
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_PartialsFromBlocks)->ArgName("blocks")->RangeMultiplier(8)->Range(8, 512);
+
+}  // namespace bench
+}  // namespace julia
+}  // namespace philote
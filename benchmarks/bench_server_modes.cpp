@@ -0,0 +1,130 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <grpcpp/grpcpp.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+#include <explicit.h>
+
+#include "julia_async_server.h"
+#include "julia_config.h"
+#include "julia_explicit_discipline.h"
+
+namespace philote {
+namespace julia {
+namespace bench {
+
+namespace {
+
+constexpr int kSyncMaxThreads = 512;  // Enough for one thread per call
+constexpr int kAsyncPollers = 2;
+
+struct BenchServer {
+    std::shared_ptr<JuliaExplicitDiscipline> discipline;
+    std::unique_ptr<JuliaAsyncServer> async_server;
+    std::unique_ptr<grpc::Server> server;
+    std::string address;
+};
+
+// Start (once) an in-process server hosting the paraboloid discipline in
+// the given mode. Servers live until the process exits.
+BenchServer& GetServer(const std::string& mode) {
+    static std::mutex mutex;
+    static std::map<std::string, BenchServer*> servers;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = servers.find(mode);
+    if (it != servers.end()) {
+        return *it->second;
+    }
+
+    DisciplineConfig config;
+    config.kind = "explicit";
+    config.julia_file =
+        std::string(PHILOTE_JULIA_TEST_DISCIPLINES_DIR) + "/paraboloid.jl";
+    config.julia_type = "ParaboloidDiscipline";
+
+    auto* bench_server = new BenchServer();
+    bench_server->discipline =
+        std::make_shared<JuliaExplicitDiscipline>(config);
+
+    int port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(),
+                             &port);
+    grpc::ResourceQuota quota;
+    quota.SetMaxThreads(kSyncMaxThreads);
+    builder.SetResourceQuota(quota);
+
+    if (mode == "async") {
+        bench_server->async_server = std::make_unique<JuliaAsyncServer>(
+            bench_server->discipline, kAsyncPollers);
+        bench_server->async_server->RegisterServices(builder);
+    } else {
+        bench_server->discipline->RegisterServices(builder);
+    }
+
+    bench_server->server = builder.BuildAndStart();
+    if (!bench_server->server) {
+        throw std::runtime_error("Failed to start benchmark server");
+    }
+    if (bench_server->async_server) {
+        bench_server->async_server->Start();
+    }
+    bench_server->address = "127.0.0.1:" + std::to_string(port);
+
+    // Run discipline setup once through a throwaway client
+    philote::ExplicitClient client;
+    client.ConnectChannel(grpc::CreateChannel(
+        bench_server->address, grpc::InsecureChannelCredentials()));
+    client.SendStreamOptions();
+    client.Setup();
+
+    servers[mode] = bench_server;
+    return *bench_server;
+}
+
+}  // namespace
+
+// One paraboloid ComputeFunction per iteration. Each benchmark thread is a
+// separate client with its own connection, so Threads(N) keeps N calls
+// outstanding against the server. The sync server needs one gRPC thread per
+// outstanding call; the async server serves all of them from kAsyncPollers.
+static void BM_ComputeFunction(benchmark::State& state, const char* mode) {
+    BenchServer& server = GetServer(mode);
+
+    grpc::ChannelArguments args;
+    args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    philote::ExplicitClient client;
+    client.ConnectChannel(grpc::CreateCustomChannel(
+        server.address, grpc::InsecureChannelCredentials(), args));
+    client.SendStreamOptions();
+    client.GetVariableDefinitions();
+
+    philote::Variables inputs;
+    inputs["x"] = philote::Variable(philote::kInput, {1});
+    inputs["y"] = philote::Variable(philote::kInput, {1});
+    inputs["x"](0) = 3.0;
+    inputs["y"](0) = 4.0;
+
+    for (auto _ : state) {
+        philote::Variables outputs = client.ComputeFunction(inputs);
+        benchmark::DoNotOptimize(outputs);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_ComputeFunction, sync, "sync")
+    ->Threads(1)->Threads(16)->Threads(64)->Threads(256)->UseRealTime();
+BENCHMARK_CAPTURE(BM_ComputeFunction, async, "async")
+    ->Threads(1)->Threads(16)->Threads(64)->Threads(256)->UseRealTime();
+
+}  // namespace bench
+}  // namespace julia
+}  // namespace philote
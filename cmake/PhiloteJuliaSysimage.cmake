@@ -0,0 +1,103 @@
+# PhiloteJuliaSysimage.cmake - Build a Julia system image for a discipline
+#
+# This module defines:
+#  philote_julia_add_sysimage(<target>
+#      CONFIG <config.yaml>      - philote-julia-serve config of the discipline
+#      [OUTPUT <file>]           - Default: <binary dir>/<target>.so
+#      [PROJECT <dir>]           - Julia environment to build in (--project)
+#      [CPU_TARGET <targets>]    - Default: PackageCompiler's portable targets
+#      [DEPENDS <files>...])     - Extra files that invalidate the image
+#
+# The config's discipline.julia_file is read at configure time (relative
+# paths against the config's directory, as build_sysimage.jl resolves it)
+# so edits to the discipline file rebuild the image; editing the config
+# re-runs the configure step.
+# <target> runs the discipline's setup!, compute and compute_partials (or
+# the implicit equivalents) on synthetic inputs under --trace-compile, then
+# bakes the discipline file and the traced precompile statements into OUTPUT
+# with PackageCompiler (see build_sysimage.jl). Point the config's
+# `sysimage` option at OUTPUT to start the server from it.
+#
+# The environment must provide YAML, PackageCompiler and the discipline's
+# packages; commit its Manifest.toml to make the image reproducible. The
+# target is not part of ALL.
+
+set(_PHILOTE_SYSIMAGE_SCRIPT "${CMAKE_CURRENT_LIST_DIR}/build_sysimage.jl")
+
+# Absolute path of the `julia_file:` entry of a serve config
+function(_philote_sysimage_julia_file config out_var)
+    file(STRINGS "${config}" lines REGEX "^[ \t]*julia_file[ \t]*:")
+    list(LENGTH lines count)
+    if(NOT count EQUAL 1)
+        message(FATAL_ERROR
+            "philote_julia_add_sysimage: expected one julia_file in ${config}")
+    endif()
+    string(REGEX REPLACE "^[ \t]*julia_file[ \t]*:[ \t]*" "" file "${lines}")
+    string(REGEX REPLACE "[ \t]+#.*$" "" file "${file}")
+    string(STRIP "${file}" file)
+    string(REGEX REPLACE "^\"(.*)\"$" "\\1" file "${file}")
+    string(REGEX REPLACE "^'(.*)'$" "\\1" file "${file}")
+    get_filename_component(config_dir "${config}" DIRECTORY)
+    get_filename_component(file "${file}" ABSOLUTE BASE_DIR "${config_dir}")
+    set(${out_var} "${file}" PARENT_SCOPE)
+endfunction()
+
+function(philote_julia_add_sysimage target)
+    # PARSE_ARGV keeps the ';' in CPU_TARGET instead of splitting on it
+    cmake_parse_arguments(PARSE_ARGV 1 ARG "" "CONFIG;OUTPUT;PROJECT;CPU_TARGET"
+                          "DEPENDS")
+    if(NOT ARG_CONFIG)
+        message(FATAL_ERROR "philote_julia_add_sysimage: CONFIG is required")
+    endif()
+    if(NOT Julia_EXECUTABLE)
+        message(FATAL_ERROR "philote_julia_add_sysimage: Julia not found")
+    endif()
+
+    get_filename_component(config "${ARG_CONFIG}" ABSOLUTE)
+    _philote_sysimage_julia_file("${config}" julia_file)
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${config}")
+    if(NOT ARG_OUTPUT)
+        set(ARG_OUTPUT
+            "${CMAKE_CURRENT_BINARY_DIR}/${target}${CMAKE_SHARED_LIBRARY_SUFFIX}")
+    endif()
+    get_filename_component(output "${ARG_OUTPUT}" ABSOLUTE
+                           BASE_DIR "${CMAKE_CURRENT_BINARY_DIR}")
+
+    set(julia_args --startup-file=no --history-file=no)
+    if(ARG_PROJECT)
+        get_filename_component(project "${ARG_PROJECT}" ABSOLUTE)
+        list(APPEND julia_args "--project=${project}")
+    endif()
+
+    set(work_dir "${CMAKE_CURRENT_BINARY_DIR}/${target}.dir")
+    set(trace "${work_dir}/trace_compile.jl")
+    set(build_args build "${config}" "${trace}" "${output}")
+    if(ARG_CPU_TARGET)
+        # Julia separates targets with ';', which must reach it as one argument
+        string(REPLACE ";" "$<SEMICOLON>" cpu_target "${ARG_CPU_TARGET}")
+        list(APPEND build_args "${cpu_target}")
+    endif()
+
+    add_custom_command(
+        OUTPUT "${trace}"
+        COMMAND "${CMAKE_COMMAND}" -E make_directory "${work_dir}"
+        COMMAND "${CMAKE_COMMAND}" -E rm -f "${trace}"
+        COMMAND "${Julia_EXECUTABLE}" ${julia_args} "--trace-compile=${trace}"
+                "${_PHILOTE_SYSIMAGE_SCRIPT}" exercise "${config}"
+        DEPENDS "${config}" "${julia_file}" "${_PHILOTE_SYSIMAGE_SCRIPT}"
+                ${ARG_DEPENDS}
+        COMMENT "Tracing compilation of the discipline in ${ARG_CONFIG}"
+        VERBATIM
+    )
+
+    add_custom_command(
+        OUTPUT "${output}"
+        COMMAND "${Julia_EXECUTABLE}" ${julia_args}
+                "${_PHILOTE_SYSIMAGE_SCRIPT}" ${build_args}
+        DEPENDS "${trace}" "${julia_file}" "${_PHILOTE_SYSIMAGE_SCRIPT}"
+        COMMENT "Building Julia sysimage ${output}"
+        VERBATIM
+    )
+
+    add_custom_target(${target} DEPENDS "${output}")
+endfunction()
@@ -0,0 +1,171 @@
+# Copyright 2025 MDO Standards
+# Licensed under the Apache License, Version 2.0
+
+# Builds a Julia system image for the discipline of a philote-julia-serve
+# config (driven by PhiloteJuliaSysimage.cmake). Runs in two steps:
+#
+#   julia --trace-compile=trace.jl build_sysimage.jl exercise config.yaml
+#   julia build_sysimage.jl build config.yaml trace.jl out.so [cpu_target]
+#
+# `exercise` loads the discipline and calls its setup and compute functions
+# on synthetic inputs shaped like its declared variables, so --trace-compile
+# records the methods the server would otherwise compile on the first
+# requests. `build` bakes the discipline file and those precompile
+# statements into a sysimage with PackageCompiler.
+#
+# The active environment must provide YAML, PackageCompiler (for `build`)
+# and the packages the discipline loads.
+
+using YAML
+if get(ARGS, 1, "") == "build"
+    import PackageCompiler
+end
+
+function load_config(path)
+    discipline = YAML.load_file(path)["discipline"]
+    file = discipline["julia_file"]
+    if !isabspath(file)
+        file = joinpath(dirname(abspath(path)), file)
+    end
+    options = something(get(discipline, "options", nothing), Dict())
+    return (kind = discipline["kind"],
+            file = normpath(file),
+            type = discipline["julia_type"],
+            options = Dict{String,Any}(string(k) => v for (k, v) in options))
+end
+
+# Ones in each declared shape and element type, in the Dict type the server
+# passes: Dict{String,Vector{T}} if every variable is 1-D, Dict{String,Array{T}}
+# otherwise, and Dict{String,Array} if element types are mixed
+function synthetic(meta)
+    arrays = Dict{String,Array}()
+    for (name, m) in meta
+        T = length(m) >= 3 ? m[3] : Float64
+        arrays[name] = ones(T, Int.(Tuple(m[1]))...)
+    end
+    types = unique(eltype(a) for a in values(arrays))
+    if length(types) > 1
+        return arrays
+    end
+    T = isempty(types) ? Float64 : only(types)
+    V = all(a -> ndims(a) == 1, values(arrays)) ? Vector{T} : Array{T}
+    return Dict{String,V}(arrays)
+end
+
+# Two-point compute_batch inputs, typed as the server stacks them:
+# Dict{String,Matrix{T}}, or Dict{String,Matrix} if element types are mixed
+function stacked(inputs)
+    columns = Dict{String,Matrix}(
+        name => ones(eltype(value), length(value), 2) for (name, value) in inputs)
+    types = unique(eltype(m) for m in values(columns))
+    if length(types) > 1
+        return columns
+    end
+    T = isempty(types) ? Float64 : only(types)
+    return Dict{String,Matrix{T}}(columns)
+end
+
+# Call Main.<name>(args...) if the discipline implements it. A call that
+# fails on synthetic inputs still leaves what it compiled in the trace
+function exercise(name::Symbol, args...)
+    isdefined(Main, name) || return nothing
+    f = getfield(Main, name)
+    Base.invokelatest(applicable, f, args...) || return nothing
+    try
+        return Base.invokelatest(f, args...)
+    catch err
+        @warn "$(name) failed on synthetic inputs" exception = err
+        return nothing
+    end
+end
+
+function run_exercise(config)
+    Base.include(Main, config.file)
+    discipline = Base.invokelatest(Core.eval(Main, Meta.parse(config.type)))
+
+    exercise(:set_options!, discipline, config.options)
+    exercise(:setup!, discipline)
+    exercise(:setup_partials!, discipline)
+
+    inputs = synthetic(discipline.inputs)
+    outputs = synthetic(discipline.outputs)
+    if config.kind == "implicit"
+        exercise(:compute_residuals, discipline, inputs, outputs)
+        exercise(:solve_residuals, discipline, inputs)
+        exercise(:compute_residual_gradients, discipline, inputs, outputs)
+    else
+        exercise(:compute, discipline, inputs)
+        exercise(:compute!, discipline, inputs, outputs)
+        exercise(:compute_batch, discipline, stacked(inputs))
+        exercise(:compute_partials, discipline, inputs)
+    end
+end
+
+# Script PackageCompiler runs in the process whose state becomes the image.
+# PhiloteSysimage.baked(file) lets JuliaRuntime::LoadJuliaFile skip
+# include()ing the discipline file while it is unchanged since the build
+const IMAGE_SCRIPT = raw"""
+module PhiloteSysimage
+
+const SOURCE = Ref("")  # Contents of the discipline file baked in
+
+baked(file::AbstractString) = isfile(file) && read(file, String) == SOURCE[]
+
+end  # module PhiloteSysimage
+
+Base.include(Main, DISCIPLINE_FILE)
+PhiloteSysimage.SOURCE[] = read(DISCIPLINE_FILE, String)
+
+for statement in eachline(PRECOMPILE_FILE)
+    try
+        Base.include_string(Main, statement)
+    catch
+        # Closures and other names that do not survive into the image
+    end
+end
+"""
+
+function run_build(config, trace_file, output, cpu_target)
+    # Runs on whatever CPU the container lands on, not just this one
+    if isempty(cpu_target)
+        cpu_target = PackageCompiler.default_app_cpu_target()
+    end
+
+    # Sorted and deduplicated so the same trace always yields the same
+    # build inputs; statements for this script's own packages are dropped
+    statements = sort!(unique(filter(readlines(trace_file)) do line
+        startswith(line, "precompile(") && !occursin("YAML.", line)
+    end))
+
+    work_dir = dirname(abspath(trace_file))
+    precompile_file = joinpath(work_dir, "precompile_statements.jl")
+    write(precompile_file, join(statements, "\n"), "\n")
+
+    script_file = joinpath(work_dir, "sysimage_script.jl")
+    write(script_file,
+          "const DISCIPLINE_FILE = $(repr(config.file))\n",
+          "const PRECOMPILE_FILE = $(repr(precompile_file))\n",
+          IMAGE_SCRIPT)
+
+    @info "Building $(output) from $(length(statements)) precompile statements" cpu_target
+    PackageCompiler.create_sysimage(Symbol[];
+                                    sysimage_path = output,
+                                    script = script_file,
+                                    cpu_target = cpu_target)
+end
+
+function main(args)
+    mode = isempty(args) ? "" : args[1]
+    if mode == "exercise" && length(args) == 2
+        run_exercise(load_config(args[2]))
+    elseif mode == "build" && length(args) in (4, 5)
+        cpu_target = length(args) == 5 ? args[5] : ""
+        run_build(load_config(args[2]), args[3], abspath(args[4]), cpu_target)
+    else
+        println(stderr, "usage: build_sysimage.jl exercise <config.yaml>")
+        println(stderr, "       build_sysimage.jl build <config.yaml> <trace.jl> <output> [cpu_target]")
+        exit(1)
+    end
+end
+
+main(ARGS)
@@ -0,0 +1,56 @@
+# Copyright 2025 MDO Standards
+# Licensed under the Apache License, Version 2.0
+
+# Single-precision surrogate over a field: the 3rd element of a metadata
+# tuple makes the server pass and expect Float32 arrays for that variable.
+# u is a Float32 field, s a Float64 scale, so the dicts mix element types.
+
+mutable struct Float32FieldDiscipline
+    inputs::Dict{String,Tuple}
+    outputs::Dict{String,Tuple}
+
+    function Float32FieldDiscipline()
+        new(Dict(), Dict())
+    end
+end
+
+function setup!(discipline::Float32FieldDiscipline)
+    discipline.inputs["u"] = ([4, 3], "m/s", Float32)
+    discipline.inputs["s"] = ([1], "")
+    discipline.outputs["v"] = ([4, 3], "m/s", Float32)
+    discipline.outputs["total"] = ([1], "m/s")
+    return nothing
+end
+
+is_thread_safe(discipline::Float32FieldDiscipline) = true
+
+function compute(discipline::Float32FieldDiscipline, inputs::AbstractDict)
+    u = inputs["u"]::Matrix{Float32}
+    s = Float32(inputs["s"][1])
+    v = s .* u
+    return Dict{String,Array}("v" => v, "total" => [Float64(sum(v))])
+end
+
+# Batched inputs keep the declared element types: Matrix{Float32} for u
+function compute_batch(discipline::Float32FieldDiscipline, inputs::AbstractDict)
+    u = inputs["u"]::Matrix{Float32}
+    s = Float32.(inputs["s"]::Matrix{Float64})
+    v = s .* u
+    return Dict{String,Array}("v" => v, "total" => Float64.(sum(v; dims=1)))
+end
+
+function compute_partials(discipline::Float32FieldDiscipline, inputs::AbstractDict)
+    u = inputs["u"]::Matrix{Float32}
+    s = Float32(inputs["s"][1])
+    # dv/du is s times the identity, dv/ds is u; dtotal/du is s everywhere
+    jac_u = zeros(Float32, 12, 12)
+    for k in 1:12
+        jac_u[k, k] = s
+    end
+    return Dict{String,Array}(
+        "v~u" => jac_u,
+        "v~s" => vec(permutedims(u)),
+        "total~u" => fill(Float64(s), 12),
+        "total~s" => [Float64(sum(u))],
+    )
+end
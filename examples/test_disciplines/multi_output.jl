@@ -24,6 +24,9 @@ function setup!(discipline::MultiOutputDiscipline)
     return nothing
 end
 
+# Stateless: compute calls may run concurrently on several executor workers
+is_thread_safe(discipline::MultiOutputDiscipline) = true
+
 function set_options!(discipline::MultiOutputDiscipline, options::Dict{String,Any})
     # No options for this discipline
     return nothing
@@ -40,6 +43,19 @@ function compute(discipline::MultiOutputDiscipline, inputs::Dict{String,Vector{F
     )
 end
 
+# Optional in-place variant, preferred over compute when defined: fill the
+# server's preallocated output arrays instead of returning new ones
+function compute!(discipline::MultiOutputDiscipline, inputs::Dict{String,Vector{Float64}},
+                  outputs::Dict{String,Vector{Float64}})
+    x = inputs["x"][1]
+    y = inputs["y"][1]
+
+    outputs["sum"][1] = x + y
+    outputs["product"][1] = x * y
+    outputs["difference"][1] = x - y
+    return nothing
+end
+
 function compute_partials(discipline::MultiOutputDiscipline, inputs::Dict{String,Vector{Float64}})
     x = inputs["x"][1]
     y = inputs["y"][1]
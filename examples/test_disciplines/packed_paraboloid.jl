@@ -0,0 +1,54 @@
+# Copyright 2025 MDO Standards
+# Licensed under the Apache License, Version 2.0
+
+# Paraboloid f(x, y) = x² + y² over the packed ABI: compute_packed! reads
+# all inputs from one vector and writes all outputs to another
+
+mutable struct PackedParaboloidDiscipline
+    inputs::Dict{String,Tuple{Vector{Int},String}}
+    outputs::Dict{String,Tuple{Vector{Int},String}}
+    x::Int  # Positions in the packed buffers, set by set_packed_index!
+    y::Int
+    f::Int
+
+    function PackedParaboloidDiscipline()
+        new(Dict(), Dict(), 0, 0, 0)
+    end
+end
+
+function setup!(discipline::PackedParaboloidDiscipline)
+    discipline.inputs["x"] = ([1], "m")
+    discipline.inputs["y"] = ([1], "m")
+    discipline.outputs["f"] = ([1], "m^2")
+    return nothing
+end
+
+is_thread_safe(discipline::PackedParaboloidDiscipline) = true
+
+function set_packed_index!(discipline::PackedParaboloidDiscipline,
+                           inputs::Dict{String,UnitRange{Int}},
+                           outputs::Dict{String,UnitRange{Int}})
+    discipline.x = first(inputs["x"])
+    discipline.y = first(inputs["y"])
+    discipline.f = first(outputs["f"])
+    return nothing
+end
+
+function compute_packed!(discipline::PackedParaboloidDiscipline,
+                         inputs::Vector{Float64}, outputs::Vector{Float64})
+    x = inputs[discipline.x]
+    y = inputs[discipline.y]
+    outputs[discipline.f] = x^2 + y^2
+    return nothing
+end
+
+# Still required alongside compute_packed!
+function compute(discipline::PackedParaboloidDiscipline, inputs::Dict{String,Vector{Float64}})
+    x = inputs["x"][1]
+    y = inputs["y"][1]
+    return Dict("f" => [x^2 + y^2])
+end
+
+function compute_partials(discipline::PackedParaboloidDiscipline, inputs::Dict{String,Vector{Float64}})
+    return Dict("f~x" => [2.0 * inputs["x"][1]], "f~y" => [2.0 * inputs["y"][1]])
+end
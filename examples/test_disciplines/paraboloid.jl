@@ -20,6 +20,9 @@ function setup!(discipline::ParaboloidDiscipline)
     return nothing
 end
 
+# Stateless: compute calls may run concurrently on several executor workers
+is_thread_safe(discipline::ParaboloidDiscipline) = true
+
 function set_options!(discipline::ParaboloidDiscipline, options::Dict{String,Any})
     # No options for this simple discipline
     return nothing
@@ -32,6 +35,14 @@ function compute(discipline::ParaboloidDiscipline, inputs::Dict{String,Vector{Fl
     return Dict("f" => [f])
 end
 
+# Optional batched evaluation (used when batch_size > 1): column j of each
+# matrix is design point j
+function compute_batch(discipline::ParaboloidDiscipline, inputs::Dict{String,Matrix{Float64}})
+    x = inputs["x"]
+    y = inputs["y"]
+    return Dict("f" => x .^ 2 .+ y .^ 2)
+end
+
 function compute_partials(discipline::ParaboloidDiscipline, inputs::Dict{String,Vector{Float64}})
     x = inputs["x"][1]
     y = inputs["y"][1]
@@ -0,0 +1,150 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_ASYNC_SERVER_H
+#define PHILOTE_JULIA_SERVER_JULIA_ASYNC_SERVER_H
+
+#include <grpcpp/server_builder.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include <discipline.h>
+#include <explicit.grpc.pb.h>
+
+#include "julia_explicit_discipline.h"
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Completion-queue gRPC front end for explicit disciplines
+ *
+ * The default server dedicates one gRPC thread to every outstanding
+ * ComputeFunction/ComputeGradient call, and that thread blocks while the
+ * Julia executor works. This server drives both streaming RPCs from a few
+ * completion-queue polling threads instead: request chunks are read
+ * asynchronously, the assembled inputs go to the executor through
+ * SubmitAsync(), and the executor's completion callback posts the call back
+ * to its queue to stream the response. No thread waits on Julia, so a small
+ * number of pollers can keep every executor worker busy at high fan-in.
+ *
+ * DisciplineService RPCs (stream options, setup, metadata, options) are
+ * infrequent and keep using Philote-Cpp's synchronous handler.
+ *
+ * Usage:
+ * @code
+ *   JuliaAsyncServer async_server(discipline, config.server.cq_threads);
+ *   async_server.RegisterServices(builder);
+ *   auto server = builder.BuildAndStart();
+ *   async_server.Start();
+ *   server->Wait();             // until server->Shutdown()
+ *   async_server.Shutdown();
+ * @endcode
+ */
+class JuliaAsyncServer {
+public:
+    /**
+     * @brief Constructor
+     * @param discipline Discipline to serve (kept alive by this server)
+     * @param num_pollers Number of completion queues / polling threads
+     */
+    JuliaAsyncServer(std::shared_ptr<JuliaExplicitDiscipline> discipline,
+                     int num_pollers);
+
+    /**
+     * @brief Destructor - shuts down if still running
+     */
+    ~JuliaAsyncServer();
+
+    JuliaAsyncServer(const JuliaAsyncServer&) = delete;
+    JuliaAsyncServer& operator=(const JuliaAsyncServer&) = delete;
+
+    /**
+     * @brief Register services and completion queues with a builder
+     * Must be called before builder.BuildAndStart()
+     */
+    void RegisterServices(grpc::ServerBuilder& builder);
+
+    /**
+     * @brief Start accepting calls and launch the polling threads
+     * Must be called after builder.BuildAndStart()
+     */
+    void Start();
+
+    /**
+     * @brief Drain the completion queues and join the polling threads
+     *
+     * Must be called after grpc::Server::Shutdown(). Waits for computes that
+     * are still running on the executor.
+     */
+    void Shutdown();
+
+    /**
+     * @brief One in-flight RPC; tags on the completion queues point at these
+     */
+    class Call {
+    public:
+        virtual ~Call() = default;
+
+        /**
+         * @brief Advance the call's state machine after a queue event
+         * @param ok Whether the completed operation succeeded
+         */
+        virtual void Proceed(bool ok) = 0;
+    };
+
+    /**
+     * @brief Run op (which starts a queue operation) unless shutting down
+     *
+     * Starting an operation on a completion queue that has been shut down
+     * is an error, so every operation goes through here.
+     *
+     * @return false if the server is shutting down and op was not run
+     */
+    template<typename Op>
+    bool Post(Op&& op) {
+        std::shared_lock<std::shared_mutex> lock(shutdown_mutex_);
+        if (shutting_down_) {
+            return false;
+        }
+        op();
+        return true;
+    }
+
+    JuliaExplicitDiscipline& discipline() { return *discipline_; }
+    philote::ExplicitService::AsyncService& service() { return service_; }
+
+    /**
+     * @brief Track computes running on the executor (for Shutdown)
+     */
+    void BeginCompute();
+    void EndCompute();
+
+private:
+    void PollLoop(grpc::ServerCompletionQueue* cq);
+
+    std::shared_ptr<JuliaExplicitDiscipline> discipline_;
+    int num_pollers_;
+
+    philote::DisciplineServer discipline_service_;
+    philote::ExplicitService::AsyncService service_;
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> queues_;
+    std::vector<std::thread> pollers_;
+
+    std::shared_mutex shutdown_mutex_;
+    bool shutting_down_ = false;
+
+    std::mutex compute_mutex_;
+    std::condition_variable compute_done_;
+    int computes_in_flight_ = 0;
+};
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_ASYNC_SERVER_H
@@ -0,0 +1,264 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_BATCHER_H
+#define PHILOTE_JULIA_SERVER_JULIA_BATCHER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "julia_executor.h"
+#include "julia_gc.h"
+#include "julia_task.h"
+#include "julia_task_queue.h"
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Coalesces concurrent requests into batched executor calls
+ *
+ * Callers submit single requests. A drain task on the executor collects up
+ * to max_batch_size pending requests, waiting at most `window` after the
+ * first one for more to arrive, passes them to the batch function in one
+ * call, and scatters the results back to the waiting callers.
+ *
+ * At most one drain task is queued or running at any time: the submitter
+ * that raises the pending count from zero schedules it, and the drain
+ * keeps collecting batches until the count is back to zero.
+ *
+ * @tparam Input Request type; submitters keep it alive until completion
+ * @tparam Output Per-request result type
+ *
+ * @note The batcher must outlive every request submitted to it.
+ */
+template<typename Input, typename Output>
+class RequestBatcher {
+public:
+    /**
+     * @brief Batch function: one result per input, in the same order
+     * Runs on an executor worker; may throw to fail the whole batch.
+     */
+    using BatchFunction =
+        std::function<std::vector<Output>(const std::vector<const Input*>&)>;
+
+    /**
+     * @brief Constructor
+     * @param batch_fn Function evaluating a whole batch
+     * @param max_batch_size Maximum requests per batch (>= 1)
+     * @param window How long a drain waits for more requests
+     * @param affinity Executor affinity of the drain task
+     */
+    RequestBatcher(BatchFunction batch_fn, size_t max_batch_size,
+                   std::chrono::microseconds window, TaskAffinity affinity)
+        : batch_fn_(std::move(batch_fn)),
+          max_batch_size_(max_batch_size),
+          window_(window),
+          affinity_(affinity),
+          queue_(kQueueCapacity) {
+        if (max_batch_size_ < 1) {
+            throw std::runtime_error("RequestBatcher needs max_batch_size >= 1");
+        }
+    }
+
+    RequestBatcher(const RequestBatcher&) = delete;
+    RequestBatcher& operator=(const RequestBatcher&) = delete;
+
+    /**
+     * @brief Submit one request and block until its batch has run
+     */
+    Output Submit(const Input& input) {
+        CompletionSlot<Output> slot;
+        Request request{&input, &slot, nullptr};
+
+        GCSafeRegion gc_safe;
+        Push(&request);
+        return slot.Get();
+    }
+
+    /**
+     * @brief Submit one request without blocking
+     * @param input Must stay alive until the handle completes
+     */
+    TaskHandle<Output> SubmitAsync(const Input& input) {
+        auto state = std::make_shared<AsyncCompletion<Output>>();
+
+        GCSafeRegion gc_safe;
+        auto request = std::make_unique<Request>(Request{&input, nullptr, state});
+        Push(request.get());
+        request.release();  // Deleted by the drain that completes it
+        return TaskHandle<Output>(std::move(state));
+    }
+
+    size_t MaxBatchSize() const { return max_batch_size_; }
+
+private:
+    static constexpr size_t kQueueCapacity = 1024;
+
+    struct Request {
+        const Input* input;
+        CompletionSlot<Output>* slot;                 // Blocking submitter
+        std::shared_ptr<AsyncCompletion<Output>> async;  // Async (heap request)
+    };
+
+    void Push(Request* request) {
+        // Count first so a drain never finishes while a request it is
+        // responsible for is still being pushed
+        if (pending_.fetch_add(1, std::memory_order_acq_rel) == 0) {
+            try {
+                ScheduleDrain();
+            } catch (...) {
+                // No drain will count this request down; the next push
+                // must schedule one again
+                pending_.fetch_sub(1, std::memory_order_acq_rel);
+                throw;
+            }
+        }
+        while (!queue_.TryPush(std::move(request))) {
+            std::this_thread::yield();
+        }
+
+        // Pairs with Collect(): either the drain sees the new count before
+        // sleeping, or we see it waiting and wake it
+        pushed_.fetch_add(1, std::memory_order_seq_cst);
+        if (collecting_.load(std::memory_order_seq_cst)) {
+            { std::lock_guard<std::mutex> lock(arrival_mutex_); }
+            arrival_cv_.notify_one();
+        }
+    }
+
+    void ScheduleDrain() {
+        JuliaExecutor::GetInstance().Post([this]() { Drain(); }, affinity_);
+    }
+
+    void Drain() {
+        // Requests that arrive while a batch runs are collected by this same
+        // task. Re-posting would fail once the executor stops, and in kSerial
+        // mode could spin on a full ring that only this worker consumes.
+        std::vector<Request*> batch;
+        batch.reserve(max_batch_size_);
+        bool more = true;
+        while (more) {
+            batch.clear();
+            more = RunBatch(batch);
+        }
+    }
+
+    // Collects, runs and delivers one batch; true if requests remain
+    bool RunBatch(std::vector<Request*>& batch) {
+        Collect(batch);
+
+        std::vector<const Input*> inputs;
+        std::vector<Output> results;
+        std::exception_ptr error;
+        try {
+            inputs.reserve(batch.size());
+            for (Request* request : batch) {
+                inputs.push_back(request->input);
+            }
+            results = batch_fn_(inputs);
+            if (results.size() != batch.size()) {
+                throw std::runtime_error(
+                    "Batch function returned " + std::to_string(results.size()) +
+                    " result(s) for " + std::to_string(batch.size()) +
+                    " request(s)");
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        // Settle this before delivering: once no requests remain, a woken
+        // caller may destroy the batcher. While some do, their submitters
+        // keep it alive.
+        size_t count = batch.size();
+        bool more = pending_.fetch_sub(count, std::memory_order_acq_rel) != count;
+
+        for (size_t i = 0; i < count; ++i) {
+            auto deliver = [&error, &results, i]() -> Output {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+                return std::move(results[i]);
+            };
+
+            Request* request = batch[i];
+            if (request->async) {
+                auto state = std::move(request->async);
+                delete request;
+                state->Run(deliver);
+            } else {
+                // The request lives in the submitter's frame: do not touch
+                // it once the slot has been completed
+                request->slot->Run(deliver);
+            }
+        }
+        return more;
+    }
+
+    void Collect(std::vector<Request*>& batch) {
+        // Waiting for stragglers does not touch Julia
+        GCSafeRegion gc_safe;
+
+        std::chrono::steady_clock::time_point deadline;
+        while (batch.size() < max_batch_size_) {
+            uint64_t pushed = pushed_.load(std::memory_order_seq_cst);
+            Request* request = nullptr;
+            if (queue_.TryPop(request)) {
+                if (batch.empty()) {
+                    deadline = std::chrono::steady_clock::now() + window_;
+                }
+                batch.push_back(request);
+                continue;
+            }
+            if (!batch.empty() && std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+
+            // Sleep until the next push completes, or the window closes.
+            // The request that scheduled this drain may still be in flight,
+            // so never return empty-handed.
+            auto arrived = [this, pushed]() {
+                return pushed_.load(std::memory_order_seq_cst) != pushed;
+            };
+            std::unique_lock<std::mutex> lock(arrival_mutex_);
+            collecting_.store(true, std::memory_order_seq_cst);
+            if (batch.empty()) {
+                arrival_cv_.wait(lock, arrived);
+            } else {
+                arrival_cv_.wait_until(lock, deadline, arrived);
+            }
+            collecting_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    BatchFunction batch_fn_;
+    size_t max_batch_size_;
+    std::chrono::microseconds window_;
+    TaskAffinity affinity_;
+
+    MpscRingQueue<Request*> queue_;  // Consumed by the single drain task
+    std::atomic<size_t> pending_{0};
+
+    // Lets a drain sleep while it waits for requests to arrive
+    std::atomic<uint64_t> pushed_{0};  // Completed pushes
+    std::atomic<bool> collecting_{false};
+    std::mutex arrival_mutex_;
+    std::condition_variable arrival_cv_;
+};
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_BATCHER_H
@@ -18,8 +18,18 @@ struct DisciplineConfig {
     std::string kind;        // "explicit" or "implicit"
     std::string julia_file;  // Absolute path to .jl file
     std::string julia_type;  // Julia type name to instantiate
+    std::string sysimage;    // Absolute path to a Julia system image ("" = default)
     std::map<std::string, std::variant<double, int, bool, std::string>>
         options;  // Optional discipline options
+    int batch_size = 1;  // Max computes coalesced into one compute_batch call
+    int batch_window_us = 0;  // How long a batch waits for more requests
+    int max_multipoint_points = 1024;  // Largest ComputeFunctionMultiPoint request
+    bool zero_copy_inputs = false;  // Opt-in: Julia aliases the caller's input buffers
+    bool reuse_input_dicts = true;  // Overwrite one input dict per worker
+    bool native_compute = true;  // Call compute_packed! through @cfunction
+    std::string array_layout;  // "row_major", "column_major", or "" (discipline decides)
+    std::map<std::string, std::string>
+        variable_layouts;  // Per-variable (or "output~input") layout overrides
 
     /**
      * @brief Validate discipline configuration
@@ -34,6 +44,14 @@ struct DisciplineConfig {
 struct ServerConfig {
     std::string address = "[::]:50051";  // Server address
     int max_threads = 10;  // Maximum worker threads for thread pool
+    std::string executor_mode = "serial";  // "serial" or "parallel"
+    int executor_workers = 1;  // Adopted executor worker threads (parallel)
+    int julia_threads = 1;  // Julia's own threads, for Threads.@spawn in disciplines
+    std::string server_mode = "sync";  // "sync" or "async" (completion queues)
+    int cq_threads = 2;  // Completion-queue polling threads (async)
+    bool gc_defer_in_tasks = false;  // Hold Julia GC off while a task runs
+    int gc_idle_ms = 0;  // Collect after this long without requests (0 = off)
+    int gc_full_threshold_mb = 0;  // Live MB above which idle GCs are full
 
     /**
      * @brief Validate server configuration
@@ -66,6 +84,10 @@ struct PhiloteConfig {
 
     /**
      * @brief Validate entire configuration
+     *
+     * Also checks combinations across sections (the async server mode
+     * only supports explicit disciplines).
+     *
      * @throws std::runtime_error if configuration is invalid
      */
     void Validate() const;
@@ -7,13 +7,47 @@
 #include <google/protobuf/struct.pb.h>
 #include <julia.h>
 
+#include <map>
 #include <string>
+#include <vector>
 
 #include <variable.h>
 
+#include "julia_kernels.h"
+#include "julia_layout.h"
+#include "julia_partials.h"
+#include "julia_sparse.h"
+
 namespace philote {
 namespace julia {
 
+/**
+ * @brief ArrayConverter of one declared variable, chosen once at setup
+ */
+struct VariableConverter {
+    std::vector<size_t> shape;  ///< Declared shape
+    ArrayConverter converter;   ///< For the declared layout and element type
+};
+
+/// Converters of a discipline's variables, by name
+using VariableConverterMap = std::map<std::string, VariableConverter>;
+
+/**
+ * @brief Build the converters of a discipline's declared variables
+ *
+ * The conversion functions below take the map to skip constructing (and,
+ * from rank 2, heap-allocating) a converter per variable and call. Data
+ * whose shape or element type differs from the declaration still gets a
+ * converter of its own.
+ *
+ * @param vars Variable metadata of the discipline
+ * @param layouts Layout and element type of each variable
+ * @return Converter of each variable
+ */
+VariableConverterMap MakeVariableConverters(
+    const std::vector<philote::VariableMetaData>& vars,
+    const ArrayLayoutMap& layouts);
+
 /**
  * @brief Convert Philote Variables to Julia Dict{String, Array{Float64}}
  *
@@ -21,12 +55,122 @@ namespace julia {
  * variable names and values are Julia arrays.
  *
  * @param vars Philote Variables to convert
+ * @param layouts Element order of each variable's data (row-major unless
+ *                listed as column-major)
+ * @param converters Converters built at setup (optional)
  * @return Julia Dict object
  * @throws std::runtime_error if conversion fails
  *
  * @note Caller is responsible for GC protection of returned object
  */
-jl_value_t* VariablesToJuliaDict(const philote::Variables& vars);
+jl_value_t* VariablesToJuliaDict(const philote::Variables& vars,
+                                 const ArrayLayoutMap& layouts = ArrayLayoutMap(),
+                                 const VariableConverterMap* converters = nullptr);
+
+/**
+ * @brief Expose Philote Variables to Julia without copying where possible
+ *
+ * Like VariablesToJuliaDict, but a variable whose buffer already has
+ * Julia's element order (column-major, or at most one dimension larger
+ * than 1) is wrapped in place with jl_ptr_to_array instead of being copied;
+ * other variables are copied as usual. The wrapped arrays do not own their
+ * data.
+ *
+ * @param vars Philote Variables to expose; must outlive every Julia
+ *             reference to the returned arrays, and are modified if Julia
+ *             writes to them
+ * @param layouts Element order of each variable's data
+ * @param converters Converters built at setup (optional)
+ * @return Julia Dict object
+ * @throws std::runtime_error if conversion fails
+ *
+ * @note Caller is responsible for GC protection of returned object
+ */
+jl_value_t* WrapVariablesAsJuliaDict(const philote::Variables& vars,
+                                     const ArrayLayoutMap& layouts = ArrayLayoutMap(),
+                                     const VariableConverterMap* converters = nullptr);
+
+/**
+ * @brief Julia array dictionary reused across calls
+ *
+ * Reset() builds the dictionary VariablesToJuliaDict would for a fixed set
+ * of variable names and shapes: one Array{T, N} per variable in its
+ * declared element type, dims and element order, each entry keeping the
+ * ArrayConverter chosen for it. Update() then overwrites the contents of
+ * its arrays in place, and Read() copies them back out, so repeated calls
+ * with the same layout allocate nothing in Julia. Used for compute inputs
+ * and for the outputs filled by an in-place compute!().
+ *
+ * With borrowing enabled, Float64 vectors of at least kMinBorrowSize
+ * elements are not copied: each Update() rebinds their entry to a fresh
+ * wrapper around the caller's buffer (see WrapVariablesAsJuliaDict), which
+ * is cheaper than the copy at that size.
+ *
+ * The caller roots dict(); everything else is reachable from it.
+ *
+ * @note Not thread-safe: use one instance per executor worker.
+ */
+class JuliaReusableDict {
+public:
+    /// Smallest vector that is wrapped rather than copied when borrowing
+    static constexpr size_t kMinBorrowSize = 4096;
+
+    /**
+     * @brief Build the dictionary for the names and sizes of vars
+     * @param vars Variables defining the layout (their values are copied)
+     * @param borrow Wrap large vectors instead of copying them
+     * @param layouts Element order of each variable's data, kept for
+     *                Update() and Read()
+     * @return The new dictionary (unrooted)
+     * @throws std::runtime_error if conversion fails
+     */
+    jl_value_t* Reset(const philote::Variables& vars, bool borrow,
+                      const ArrayLayoutMap& layouts = ArrayLayoutMap());
+
+    /**
+     * @brief Check whether vars have the names and shapes of the dictionary
+     */
+    bool Matches(const philote::Variables& vars) const;
+
+    /**
+     * @brief Overwrite the dictionary contents with vars
+     * @param vars Variables with the same names and shapes as at Reset(); any
+     *             borrowed buffers must outlive Julia's use of the dict
+     * @return The dictionary, or nullptr if vars do not match the layout
+     *         (nothing is modified in that case)
+     * @throws std::runtime_error if a Julia call fails
+     */
+    jl_value_t* Update(const philote::Variables& vars);
+
+    /**
+     * @brief Copy the dictionary contents into vars
+     *
+     * Entries are looked up again by key, so a Julia function that replaced
+     * an array instead of filling it is still read correctly.
+     *
+     * @param vars Variables matching the layout; values are overwritten
+     * @throws std::runtime_error if vars do not match or an entry no longer
+     *         has the element type and dims it was built with
+     */
+    void Read(philote::Variables& vars);
+
+    /**
+     * @brief The current dictionary (nullptr before the first Reset())
+     */
+    jl_value_t* dict() const { return dict_; }
+
+private:
+    struct Entry {
+        jl_value_t* key;     // Key string stored in the dict
+        jl_array_t* array;   // Preallocated array (nullptr if borrowed)
+        size_t size;
+        std::vector<size_t> shape;  // Declared dims of the variable
+        ArrayConverter converter;  // Chosen once, at Reset()
+    };
+
+    jl_value_t* dict_ = nullptr;
+    std::map<std::string, Entry> entries_;
+};
 
 /**
  * @brief Convert Julia Dict to Philote Variables
@@ -34,10 +178,14 @@ jl_value_t* VariablesToJuliaDict(const philote::Variables& vars);
  * Converts a Julia Dict{String, Array{Float64}} to Philote Variables map.
  *
  * @param dict Julia dictionary to convert
+ * @param layouts Element order to give each variable's data
+ * @param converters Converters built at setup (optional)
  * @return Philote Variables object
  * @throws std::runtime_error if conversion fails or dict has wrong type
  */
-philote::Variables JuliaDictToVariables(jl_value_t* dict);
+philote::Variables JuliaDictToVariables(jl_value_t* dict,
+                                        const ArrayLayoutMap& layouts = ArrayLayoutMap(),
+                                        const VariableConverterMap* converters = nullptr);
 
 /**
  * @brief Convert Julia Dict to Philote Partials
@@ -46,10 +194,99 @@ philote::Variables JuliaDictToVariables(jl_value_t* dict);
  * Partials map. Keys are (output, input) tuples.
  *
  * @param dict Julia dictionary to convert
+ * @param layouts Element order to give each partial's data (see
+ *                ArrayLayoutMap::GetPartial)
  * @return Philote Partials object
  * @throws std::runtime_error if conversion fails or dict has wrong type
  */
-philote::Partials JuliaDictToPartials(jl_value_t* dict);
+philote::Partials JuliaDictToPartials(jl_value_t* dict,
+                                      const ArrayLayoutMap& layouts = ArrayLayoutMap());
+
+/**
+ * @brief Convert Julia Dict to Philote Partials, keeping sparse blocks sparse
+ *
+ * Like JuliaDictToPartials(), except that the value of a key with a
+ * sparsity pattern must hold exactly the pattern's stored entries, and is
+ * returned in sparse rather than densified.
+ *
+ * @param dict Julia dictionary to convert
+ * @param patterns Sparsity pattern of each sparse partial
+ * @param sparse Receives the sparse partials
+ * @param layouts Element order to give each dense partial's data
+ * @param table Block table of the declared partials, whose converters are
+ *              used for values of the declared shape (optional)
+ * @return Dense partials (keys without a pattern)
+ * @throws std::runtime_error if conversion fails or a sparse value does not
+ *         match its pattern
+ */
+philote::Partials JuliaDictToSparsePartials(jl_value_t* dict,
+                                            const SparsityPatterns& patterns,
+                                            SparsePartials& sparse,
+                                            const ArrayLayoutMap& layouts = ArrayLayoutMap(),
+                                            const PartialsBlockTable* table = nullptr);
+
+/**
+ * @brief Convert block-indexed partials from Julia to Philote Partials
+ *
+ * Element k of the vector holds the values of block k of the partials
+ * index table (1-based in Julia), or nothing if that block is not
+ * computed. Keys, shapes and layouts come from the table, so no key is
+ * parsed or looked up.
+ *
+ * @param blocks Julia Vector of arrays returned by compute_partials()
+ * @param table Partials block index table
+ * @param sparse Receives the stored entries of blocks with a pattern
+ * @return Dense partials
+ * @throws std::runtime_error if the vector or a block has the wrong size
+ */
+philote::Partials JuliaBlocksToPartials(jl_value_t* blocks,
+                                       const PartialsBlockTable& table,
+                                       SparsePartials& sparse);
+
+/**
+ * @brief Convert several input points to column-stacked Julia arrays
+ *
+ * Builds a Julia Dict{String, Matrix{T}} with one matrix per variable of
+ * size (variable length) x (number of points), T being the variables'
+ * declared element type (Dict{String, Matrix} if Float64 and Float32 are
+ * mixed). Column j holds point j's variable flattened in the same element
+ * order a single-point conversion would give Julia, so
+ * `reshape(m[:, j], dims...)` recovers it.
+ *
+ * @param points Input sets; all must have the same variables and sizes
+ * @param layouts Element order and element type of each variable's data
+ * @param converters Converters built at setup (optional)
+ * @return Julia Dict object
+ * @throws std::runtime_error if the points are inconsistent
+ *
+ * @note Caller is responsible for GC protection of returned object
+ */
+jl_value_t* StackedVariablesToJuliaDict(
+    const std::vector<const philote::Variables*>& points,
+    const ArrayLayoutMap& layouts = ArrayLayoutMap(),
+    const VariableConverterMap* converters = nullptr);
+
+/**
+ * @brief Split column-stacked Julia arrays back into per-point Variables
+ *
+ * Inverse of StackedVariablesToJuliaDict for a result dictionary.
+ *
+ * @param dict Julia Dict{String, <array>} with num_points columns per entry
+ * @param shapes Expected shape of each variable to extract
+ * @param num_points Number of stacked points
+ * @param layouts Element order to give each variable's data
+ * @param converters Converters built at setup (optional)
+ * @return One Variables map per point
+ * @throws std::runtime_error if an entry is missing, is not a
+ *         (variable length) x num_points matrix, or has an element type
+ *         other than Float64/Float32
+ */
+std::vector<philote::Variables> JuliaDictToStackedVariables(
+    jl_value_t* dict,
+    const std::map<std::string, std::vector<size_t>>& shapes,
+    size_t num_points,
+    const ArrayLayoutMap& layouts = ArrayLayoutMap(),
+    const VariableConverterMap* converters = nullptr);
 
 /**
  * @brief Convert protobuf Struct to Julia Dict
@@ -4,81 +4,244 @@
 #ifndef PHILOTE_JULIA_SERVER_JULIA_EXECUTOR_H
 #define PHILOTE_JULIA_SERVER_JULIA_EXECUTOR_H
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
-#include <functional>
-#include <future>
+#include <cstdint>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
+#include <vector>
+
+#include "julia_gc.h"
+#include "julia_task.h"
+#include "julia_task_queue.h"
 
 namespace philote {
 namespace julia {
 
 /**
- * @brief Single-threaded executor for Julia calls
+ * @brief Where a submitted task is allowed to run
+ */
+enum class TaskAffinity {
+    kSerial,     // Primary worker only; serialized with all other kSerial tasks
+    kAnyWorker,  // Any worker; may run concurrently with other tasks
+};
+
+/**
+ * @brief When the executor lets Julia collect garbage
+ *
+ * By default Julia collects whenever an allocation trips its thresholds,
+ * which is usually in the middle of a request. The policy can hold
+ * collections off while tasks run and catch up once the executor has been
+ * idle for a while instead.
+ */
+struct GCPolicy {
+    // Disable collection while a task runs; requires full_threshold_bytes,
+    // since the disable is process-wide and overlapping tasks on several
+    // workers could otherwise hold collections off indefinitely
+    bool defer_in_tasks = false;
+    // Collect once no worker has run a task for this long (0 = never)
+    std::chrono::milliseconds idle_interval{0};
+    // Live bytes above which idle collections are full and tasks no longer
+    // defer collection (0 = no threshold)
+    size_t full_threshold_bytes = 0;
+};
+
+/**
+ * @brief Julia collections counted by where they were triggered
+ */
+struct GCCounts {
+    uint64_t during_tasks = 0;   // On an executor worker, inside a task
+    uint64_t outside_tasks = 0;  // Anywhere else, idle collections included
+    uint64_t idle = 0;           // Started by the idle policy
+    uint64_t idle_full = 0;      // Idle collections that were full
+};
+
+/**
+ * @brief Executor for Julia calls running on dedicated adopted threads
  *
- * ALL Julia operations must be executed on a single dedicated thread.
- * gRPC worker threads submit tasks to this executor and wait for completion.
- * This ensures no concurrent Julia calls regardless of gRPC threading.
+ * ALL Julia operations must be executed on executor workers. gRPC worker
+ * threads submit tasks to this executor and wait for completion.
+ *
+ * By default the executor runs a single worker, so no two Julia calls ever
+ * run concurrently. When started with several workers, tasks submitted with
+ * TaskAffinity::kAnyWorker are spread across all workers, while kSerial
+ * tasks (loading, setup, and disciplines that are not thread-safe) keep
+ * running one at a time on the primary worker.
+ *
+ * Each worker consumes a bounded lock-free MPSC ring. An idle worker spins
+ * briefly, then yields, then parks on a futex-backed atomic wait; producers
+ * only issue a wake-up when the worker is actually parked.
+ *
+ * A GCPolicy can keep collections out of tasks and run them between
+ * requests: once no worker has run a task for idle_interval, a worker
+ * triggers an incremental collection (GC.gc(false)), or a full one above
+ * full_threshold_bytes of live data.
  */
 class JuliaExecutor {
 public:
     static JuliaExecutor& GetInstance();
 
     /**
-     * @brief Start the Julia executor thread
+     * @brief Start the Julia executor workers
      * Must be called after Julia runtime is initialized
+     * @param num_workers Number of adopted worker threads (>= 1)
      */
-    void Start();
+    void Start(int num_workers = 1);
 
     /**
-     * @brief Stop the Julia executor thread
+     * @brief Stop the Julia executor workers
+     *
+     * Submissions made once Stop() has begun throw. Tasks already queued
+     * still run before the workers exit.
      */
     void Stop();
 
     /**
-     * @brief Submit a task to execute on the Julia thread
-     * Blocks until the task completes
+     * @brief Number of running worker threads
+     */
+    int NumWorkers() const { return static_cast<int>(workers_.size()); }
+
+    /**
+     * @brief Index of the worker running the calling thread
+     * @return 0 .. NumWorkers() - 1 on an executor worker, -1 elsewhere
+     */
+    static int CurrentWorkerIndex();
+
+    /**
+     * @brief Change when Julia may collect garbage
+     * Takes effect from each worker's next task.
+     * @param policy Collection policy
+     * @throws std::runtime_error if defer_in_tasks is set without a
+     *         full_threshold_bytes limit
+     */
+    void SetGCPolicy(const GCPolicy& policy);
+
+    /**
+     * @brief Current collection policy
+     */
+    GCPolicy GetGCPolicy() const;
+
+    /**
+     * @brief Collections so far, inside and outside executor tasks
+     * Counted from the first Start().
+     */
+    static GCCounts CollectionCounts();
+
+    /**
+     * @brief Submit a task to execute on a Julia worker thread
+     * Blocks until the task completes. The round trip performs no heap
+     * allocation: the task is referenced from this frame and its result is
+     * written into a stack-resident CompletionSlot.
      * @param task Function to execute on Julia thread
+     * @param affinity Which workers may run the task
+     * @throws std::runtime_error if the executor is not running
      */
     template<typename Func>
-    auto Submit(Func&& task) -> decltype(task()) {
+    auto Submit(Func&& task, TaskAffinity affinity = TaskAffinity::kSerial)
+        -> decltype(task()) {
         using ReturnType = decltype(task());
 
-        std::promise<ReturnType> promise;
-        auto future = promise.get_future();
-
-        {
-            std::lock_guard<std::mutex> lock(queue_mutex_);
-            task_queue_.push([&promise, task = std::forward<Func>(task)]() {
-                try {
-                    if constexpr (std::is_void_v<ReturnType>) {
-                        task();
-                        promise.set_value();
-                    } else {
-                        promise.set_value(task());
-                    }
-                } catch (...) {
-                    promise.set_exception(std::current_exception());
-                }
-            });
-        }
-        cv_.notify_one();
-
-        return future.get();
+        CompletionSlot<ReturnType> slot;
+
+        // The caller may itself be a Julia thread (e.g. the thread that ran
+        // jl_init), so it must not hold up a collection on the workers while
+        // it queues and waits
+        GCSafeRegion gc_safe;
+
+        // Capturing by reference is safe: this frame outlives the task
+        Enqueue(affinity, [&slot, &task]() { slot.Run(task); });
+
+        return slot.Get();
+    }
+
+    /**
+     * @brief Submit a task without blocking the caller
+     *
+     * Returns immediately with a handle that can be waited on, polled,
+     * given a completion callback, or co_awaited from a C++20 coroutine.
+     * Unlike Submit(), the task is moved into the queue and its completion
+     * state is shared with the handle (one allocation).
+     *
+     * @param task Function to execute on Julia thread
+     * @param affinity Which workers may run the task
+     * @return Handle to the task's result
+     * @throws std::runtime_error if the executor is not running
+     */
+    template<typename Func>
+    auto SubmitAsync(Func&& task, TaskAffinity affinity = TaskAffinity::kSerial)
+        -> TaskHandle<decltype(task())> {
+        using ReturnType = decltype(task());
+
+        auto state = std::make_shared<AsyncCompletion<ReturnType>>();
+
+        // Enqueue may briefly spin on a full ring; stay GC-safe meanwhile
+        GCSafeRegion gc_safe;
+        Enqueue(affinity, [state, task = std::forward<Func>(task)]() mutable {
+            state->Run(task);
+        });
+
+        return TaskHandle<ReturnType>(std::move(state));
+    }
+
+    /**
+     * @brief Queue a fire-and-forget task
+     *
+     * Nothing waits for the task and no completion state is allocated. The
+     * task should not throw: there is no caller to receive the exception,
+     * so the worker only logs it.
+     *
+     * @param task Function to execute on Julia thread
+     * @param affinity Which workers may run the task
+     * @throws std::runtime_error if the executor is not running
+     */
+    template<typename Func>
+    void Post(Func&& task, TaskAffinity affinity = TaskAffinity::kSerial) {
+        GCSafeRegion gc_safe;
+        Enqueue(affinity, Task(std::forward<Func>(task)));
     }
 
 private:
     JuliaExecutor() = default;
     ~JuliaExecutor();
 
-    void ExecutorLoop();
+    struct Worker {
+        explicit Worker(size_t capacity) : task_queue(capacity) {}
+
+        std::thread thread;
+        MpscRingQueue<Task> task_queue;
+        std::atomic<uint32_t> wake_epoch{0};  // Bumped to unpark the worker
+        std::atomic<bool> parked{false};
+        std::mutex park_mutex;  // Timed parks, while an idle collection is due
+        std::condition_variable park_cv;
+        std::atomic<size_t> pending{0};
+        std::atomic<bool> stop{false};
+    };
+
+    enum class WaitResult { kTask, kStop, kIdle };
+    using Clock = std::chrono::steady_clock;
+
+    Worker& SelectWorker(TaskAffinity affinity);
+    void Enqueue(TaskAffinity affinity, Task task);
+    static void Wake(Worker& worker);
+    static WaitResult WaitForTask(Worker* worker, Task& task,
+                                  Clock::time_point deadline);
+    void ExecutorLoop(Worker* worker, int index);
+    void RunTask(Task& task);
+    Clock::time_point CollectIfIdle();
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<size_t> next_worker_{0};
+    std::atomic<bool> stopping_{false};  // Set by Stop(); rejects new tasks
+    std::atomic<int> enqueuing_{0};      // Enqueue() calls in progress
 
-    std::thread executor_thread_;
-    std::queue<std::function<void()>> task_queue_;
-    std::mutex queue_mutex_;
-    std::condition_variable cv_;
-    bool stop_ = false;
+    // GCPolicy, readable by the workers while it changes
+    std::atomic<bool> gc_defer_in_tasks_{false};
+    std::atomic<int64_t> gc_idle_interval_ns_{0};
+    std::atomic<size_t> gc_full_threshold_{0};
+    std::atomic<int64_t> last_task_end_ns_{0};  // Clock time, any worker
+    std::atomic<bool> gc_due_{false};  // Tasks ran since the last idle collection
 };
 
 }  // namespace julia
@@ -6,11 +6,20 @@
 
 #include <julia.h>
 
+#include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include <explicit.h>
 
+#include "julia_batcher.h"
 #include "julia_config.h"
+#include "julia_convert.h"
+#include "julia_executor.h"
+#include "julia_packed.h"
+#include "julia_roots.h"
+#include "julia_sparse.h"
 
 namespace philote {
 namespace julia {
@@ -28,8 +37,29 @@ namespace julia {
  * Thread Safety:
  * - Initialize(), Setup(), SetupPartials() called from main thread
  * - Compute(), ComputePartials() called from gRPC worker threads concurrently
- * - Uses mutex to serialize Julia calls (required for thread safety)
- * - Each thread adopts itself via JuliaThreadGuard
+ * - All Julia calls run on JuliaExecutor workers. They are serialized unless
+ *   the Julia discipline defines is_thread_safe(discipline) returning true,
+ *   in which case compute calls may run on any executor worker.
+ * - If the Julia discipline defines compute_batch() and batch_size > 1,
+ *   concurrent compute calls are coalesced into one compute_batch() call
+ *   with column-stacked inputs (see RequestBatcher).
+ * - If the Julia discipline defines compute!(discipline, inputs, outputs),
+ *   it is called instead of compute() with preallocated output arrays.
+ * - If it defines compute_packed!(discipline, inputs, outputs), that is
+ *   called instead, with all inputs packed into one Vector{Float64} and
+ *   all outputs read back from another (see PackedIndex). Unless
+ *   native_compute is off, it is reached through a @cfunction pointer
+ *   compiled for the concrete discipline type at load, not jl_call.
+ * - Variables declared column-major (array_layout(discipline) or the YAML
+ *   array_layout/variable_layouts keys) are exchanged with clients in
+ *   Julia's element order and cross the boundary without a transpose.
+ * - Partials given a sparsity pattern in setup_partials!() are returned by
+ *   compute_partials() as their stored entries only; they stay sparse
+ *   through ComputeSparsePartials() and are scattered into dense blocks
+ *   only for Philote's dense ComputeGradient.
+ * - If the Julia discipline defines set_partials_index!(discipline, index),
+ *   it receives the (output, input) => block number table at setup and
+ *   compute_partials() may return a Vector of blocks in that order.
  *
  * @note Inherits from philote::ExplicitDiscipline (Philote-Cpp library)
  */
@@ -53,6 +83,76 @@ public:
     JuliaExplicitDiscipline(JuliaExplicitDiscipline&&) = delete;
     JuliaExplicitDiscipline& operator=(JuliaExplicitDiscipline&&) = delete;
 
+    /**
+     * @brief Allocate zeroed input variables shaped from the I/O metadata
+     *
+     * Used by servers that assemble streamed inputs themselves.
+     */
+    philote::Variables AllocateInputs();
+
+    /**
+     * @brief Element order of each variable's data as seen by clients
+     *
+     * Resolved once the discipline is loaded: per-variable settings take
+     * precedence over discipline-wide ones, and the YAML configuration over
+     * the discipline's own array_layout() declaration at the same level.
+     */
+    const ArrayLayoutMap& array_layouts() const { return array_layouts_; }
+
+    /**
+     * @brief Sparsity patterns declared by setup_partials!()
+     *
+     * Partials without an entry are dense.
+     */
+    const SparsityPatterns& sparsity_patterns() const {
+        return sparsity_patterns_;
+    }
+
+    /**
+     * @brief Submit compute() without blocking the caller
+     *
+     * Same as Compute(), but returns a handle instead of waiting. Used by
+     * the completion-queue server so no gRPC thread blocks on Julia.
+     *
+     * @param inputs Input variables; must stay alive until the task completes
+     * @return Handle to the outputs
+     */
+    TaskHandle<philote::Variables> ComputeAsync(
+        const philote::Variables& inputs);
+
+    /**
+     * @brief Submit compute_partials() without blocking the caller
+     *
+     * @param inputs Input variables; must stay alive until the task completes
+     * @return Handle to the partials
+     */
+    TaskHandle<philote::Partials> ComputePartialsAsync(
+        const philote::Variables& inputs);
+
+    /**
+     * @brief Evaluate several input points in one executor task
+     *
+     * Uses compute_batch() with column-stacked inputs when the discipline
+     * defines it, and loops compute() otherwise. Bypasses the request
+     * batcher: the points are already a batch.
+     *
+     * @param points Input sets
+     * @return One output set per point, in order
+     */
+    std::vector<philote::Variables> ComputeMultiPoint(
+        const std::vector<philote::Variables>& points);
+
+    /**
+     * @brief Compute partials without densifying sparse blocks
+     *
+     * @param inputs Input variables
+     * @param dense Receives the partials without a sparsity pattern
+     * @param sparse Receives the stored entries of the sparse partials
+     */
+    void ComputeSparsePartials(const philote::Variables& inputs,
+                               philote::Partials& dense,
+                               SparsePartials& sparse);
+
 protected:
     /**
      * @brief Initialize discipline (called from main thread)
@@ -73,7 +173,8 @@ protected:
      * @brief Setup partial derivatives (called from main thread)
      *
      * Calls Julia setup_partials!() if available, then extracts
-     * partial derivative metadata.
+     * partial derivative metadata, builds the partials block index table
+     * and passes it to set_partials_index!() if available.
      */
     void SetupPartials() override;
 
@@ -134,10 +235,116 @@ private:
      * @brief Extract partial derivative metadata from Julia discipline
      *
      * Queries Julia discipline for available partials, then registers
-     * them with Philote-Cpp using DeclarePartials().
+     * them with Philote-Cpp using DeclarePartials(). A (rows, cols) tuple
+     * of index vectors as the value of a partial declares its sparsity
+     * pattern.
      */
     void ExtractPartialsMetadata();
 
+    /**
+     * @brief Combine array_layout(discipline) with the configured layouts
+     *
+     * The Julia function may return a layout name (String or Symbol) for
+     * the whole discipline, or a dict of variable name (or "output~input")
+     * to layout name (executor worker only).
+     */
+    void ResolveArrayLayouts();
+
+    /**
+     * @brief Reject layouts given for names the discipline does not declare
+     *
+     * Layouts are resolved when the discipline loads, before setup!()
+     * declares its variables, so the names are checked afterwards.
+     *
+     * @throws std::runtime_error naming the first unknown variable
+     */
+    void CheckArrayLayoutNames();
+
+    /**
+     * @brief Call Julia compute() (executor worker only)
+     */
+    philote::Variables RunCompute(const philote::Variables& inputs);
+
+    /**
+     * @brief Call Julia compute!() into preallocated outputs
+     *
+     * The outputs dict is this worker's persistent dict, shaped from the
+     * output metadata, so a steady-state call allocates nothing on the
+     * Julia heap (executor worker only).
+     *
+     * @param inputs Input values
+     * @param outputs Outputs shaped from the metadata; overwritten
+     */
+    void RunComputeInPlace(const philote::Variables& inputs,
+                           philote::Variables& outputs);
+
+    /**
+     * @brief Call Julia compute_packed!() on this worker's packed buffers
+     *
+     * Inputs are packed into one Vector{Float64} and outputs unpacked from
+     * another, both kept rooted per worker, so a call passes two arrays
+     * and no dict (executor worker only).
+     */
+    philote::Variables RunComputePacked(const philote::Variables& inputs);
+
+    /**
+     * @brief Compile a native entry point for compute_packed!()
+     *
+     * Builds a closure over the discipline instance, specialized for its
+     * concrete type and precompiled, and takes its @cfunction pointer. The
+     * closure catches Julia exceptions and reports them through a message
+     * buffer, since none may unwind into C++ (executor worker only).
+     */
+    void CompileNativeCompute();
+
+    /**
+     * @brief Build the packed input and output indexes after setup!()
+     *
+     * Passes them to set_packed_index!() as Dict{String,UnitRange{Int}} if
+     * the discipline defines it (executor worker only).
+     */
+    void BuildPackedIndexes();
+
+    /**
+     * @brief Allocate zeroed output variables shaped from the I/O metadata
+     */
+    philote::Variables AllocateOutputs();
+
+    /**
+     * @brief Call Julia compute_partials() (executor worker only)
+     *
+     * Sparse partials are scattered into dense blocks.
+     */
+    philote::Partials RunComputePartials(const philote::Variables& inputs);
+
+    /**
+     * @brief Call Julia compute_partials(), keeping sparse partials sparse
+     *
+     * @return Dense partials, and the sparse partials (executor worker only)
+     */
+    std::pair<philote::Partials, SparsePartials> RunComputeSparsePartials(
+        const philote::Variables& inputs);
+
+    /**
+     * @brief Call Julia compute_batch() for several input points at once
+     *
+     * Inputs are passed as Dict{String, Matrix{Float64}} with one column per
+     * point; the returned dict must have the same layout for every output.
+     * A single point, or a discipline without compute_batch(), goes through
+     * compute() once per point instead (executor worker only).
+     */
+    std::vector<philote::Variables> RunComputeBatch(
+        const std::vector<const philote::Variables*>& points);
+
+    /**
+     * @brief Convert compute inputs to a Julia dict (executor worker only)
+     *
+     * Reuses this worker's persistent input dict when reuse_input_dicts is
+     * enabled, rebuilding it only when the input layout changes; otherwise
+     * builds a fresh dict.
+     */
+    jl_value_t* InputsToJulia(const philote::Variables& inputs);
+
     /**
      * @brief Get Julia function from discipline module
      * @param name Function name
@@ -145,6 +352,18 @@ private:
      */
     jl_function_t* GetJuliaFunction(const std::string& name);
 
+    /**
+     * @brief Get an optional Julia function if it has a method for this
+     *        discipline's type
+     *
+     * Every discipline is loaded into Main, so a function defined by one
+     * may only have methods for another discipline's type.
+     *
+     * @param name Function name
+     * @return Julia function, or nullptr if missing or not applicable
+     */
+    jl_function_t* GetDisciplineMethod(const std::string& name);
+
     /**
      * @brief Get discipline object from Julia globals
      * @return Julia discipline object
@@ -152,9 +371,49 @@ private:
      */
     jl_value_t* GetDisciplineObject();
 
+    /**
+     * @brief Executor affinity for compute and compute_partials calls
+     */
+    TaskAffinity ComputeAffinity() const {
+        return thread_safe_ ? TaskAffinity::kAnyWorker : TaskAffinity::kSerial;
+    }
+
     DisciplineConfig config_;
     jl_module_t* module_;           // Julia module containing discipline
-    jl_value_t* discipline_obj_;    // Julia discipline instance
+    JuliaRoot discipline_obj_;      // Julia discipline instance
+    bool thread_safe_ = false;      // Discipline declared is_thread_safe
+    bool has_compute_batch_ = false;  // Discipline defines compute_batch
+    bool has_compute_inplace_ = false;  // Discipline defines compute!
+    bool has_compute_packed_ = false;   // Discipline defines compute_packed!
+    ArrayLayoutMap array_layouts_;  // Element order of each variable
+    VariableConverterMap variable_converters_;  // Built with var_meta
+    SparsityPatterns sparsity_patterns_;  // Declared by setup_partials!()
+    PartialsBlockTable partials_table_;   // Block k of indexed partials
+
+    // Reusable input and compute! output dicts, one per executor worker,
+    // rooted in the runtime's root pool: root w holds worker w's input
+    // dict, root NumWorkers + w its output dict
+    std::vector<JuliaReusableDict> input_dicts_;
+    std::vector<JuliaReusableDict> output_dicts_;
+    std::vector<JuliaRoot> dict_roots_;
+
+    // Packed ABI: name-to-offset tables built at Setup, and per-worker
+    // input/output Vector{Float64} buffers in roots 2w and 2w + 1
+    PackedIndex packed_inputs_;
+    PackedIndex packed_outputs_;
+    std::vector<JuliaRoot> packed_roots_;
+
+    // compute_packed!(discipline, inputs, outputs) as a native function on
+    // the rooted Vector{Float64} buffers: returns nonzero and writes a
+    // NUL-terminated message on error
+    using NativeComputeFn = int (*)(jl_value_t* inputs, jl_value_t* outputs,
+                                    char* message, size_t message_size);
+    NativeComputeFn native_compute_ = nullptr;
+    JuliaRoot native_root_;  // (cfunction, pointer) tuple behind it
+
+    // Coalesces concurrent computes (null unless batching is enabled)
+    std::unique_ptr<RequestBatcher<philote::Variables, philote::Variables>>
+        batcher_;
 
     // Thread safety: Mutex to serialize Julia calls
     mutable std::mutex compute_mutex_;
@@ -6,12 +6,121 @@
 
 #include <julia.h>
 
+#include <cstddef>
 #include <initializer_list>
-#include <vector>
 
 namespace philote {
 namespace julia {
 
+/**
+ * @brief GC frame with N root slots, stored inline on the C++ stack
+ *
+ * The object itself is the frame Julia's GC walks: a header followed by N
+ * root slots, linked onto the current task's GC stack for the object's
+ * lifetime, as JL_GC_PUSHARGS does with alloca. Slots start out null and
+ * can be filled and refilled at any time, so one frame can root every
+ * temporary of a loop with no allocation at all:
+ *
+ * @code
+ * GCFrame<2> frame;
+ * for (...) {
+ *     jl_value_t* key = frame.Set(0, jl_cstr_to_string(name));
+ *     jl_value_t* value = frame.Set(1, jl_box_float64(x));
+ *     ...
+ * }
+ * @endcode
+ *
+ * Frames must be destroyed in reverse order of construction (automatic
+ * for scoped objects), and must not be copied, moved or heap-allocated.
+ *
+ * @tparam N Number of root slots
+ */
+template <size_t N>
+class GCFrame {
+public:
+    static_assert(N > 0, "a GC frame needs at least one root slot");
+
+    /// Push a frame of N null roots
+    GCFrame() : nroots_(JL_GC_ENCODE_PUSHARGS(N)), prev_(jl_pgcstack) {
+        for (jl_value_t*& root : roots_) {
+            root = nullptr;
+        }
+        jl_pgcstack = reinterpret_cast<jl_gcframe_t*>(this);
+    }
+
+    /// Push a frame rooting objs (the remaining slots are null)
+    template <typename... T>
+    explicit GCFrame(T*... objs) : GCFrame() {
+        static_assert(sizeof...(T) <= N, "more objects than root slots");
+        size_t i = 0;
+        ((roots_[i++] = reinterpret_cast<jl_value_t*>(objs)), ...);
+    }
+
+    ~GCFrame() { jl_pgcstack = prev_; }
+
+    GCFrame(const GCFrame&) = delete;
+    GCFrame& operator=(const GCFrame&) = delete;
+
+    /**
+     * @brief Root obj in slot i, replacing what the slot held
+     * @return obj, so a call can be rooted as it returns
+     */
+    template <typename T>
+    T* Set(size_t i, T* obj) {
+        roots_[i] = reinterpret_cast<jl_value_t*>(obj);
+        return obj;
+    }
+
+    jl_value_t*& operator[](size_t i) { return roots_[i]; }
+
+    static constexpr size_t size() { return N; }
+
+private:
+    // Layout of jl_gcframe_t followed by its roots
+    size_t nroots_;
+    jl_gcframe_t* prev_;
+    jl_value_t* roots_[N];
+};
+
+/**
+ * @brief GC frame with a run-time number of root slots
+ *
+ * Like GCFrame, but the frame lives in a per-thread arena of fixed chunks
+ * that is reused frame after frame, so a root set of any size (one slot
+ * per variable of a large discipline, say) costs no heap allocation once
+ * the arena has grown to it. Same lifetime rules as GCFrame.
+ */
+class GCArenaFrame {
+public:
+    /**
+     * @brief Push a frame of n null roots
+     * @param n Number of root slots (may be 0)
+     */
+    explicit GCArenaFrame(size_t n);
+
+    ~GCArenaFrame();
+
+    GCArenaFrame(const GCArenaFrame&) = delete;
+    GCArenaFrame& operator=(const GCArenaFrame&) = delete;
+
+    /// See GCFrame::Set()
+    template <typename T>
+    T* Set(size_t i, T* obj) {
+        roots_[i] = reinterpret_cast<jl_value_t*>(obj);
+        return obj;
+    }
+
+    jl_value_t*& operator[](size_t i) { return roots_[i]; }
+
+    size_t size() const { return size_; }
+
+private:
+    jl_value_t** roots_ = nullptr;
+    size_t size_ = 0;
+    size_t mark_chunk_ = 0;  // Arena position to return to when popped
+    size_t mark_used_ = 0;
+};
+
 /**
  * @brief RAII wrapper for Julia garbage collection protection
  *
@@ -27,10 +136,18 @@ namespace julia {
  * // obj automatically unrooted when protect goes out of scope
  * @endcode
  *
+ * Up to kInlineRoots objects are held in a frame inside the object, more
+ * in the thread's GCArenaFrame arena, so protection does not allocate.
+ * Loops that root temporaries on every iteration should prefer a GCFrame
+ * declared outside the loop.
+ *
  * @note Thread Safety: GC protection is per-thread (uses thread-local GC stack)
  */
 class GCProtect {
 public:
+    /// Objects rooted without touching the arena
+    static constexpr size_t kInlineRoots = 4;
+
     /**
      * @brief Protect a single Julia object
      * @param obj Julia object to protect
@@ -55,8 +172,36 @@ public:
     GCProtect& operator=(GCProtect&&) = delete;
 
 private:
-    std::vector<jl_value_t*> protected_objects_;
-    size_t count_;
+    void Push(const jl_value_t* const* objs, size_t count);
+
+    // Header and roots of the frame when it fits inline
+    void* inline_frame_[2 + kInlineRoots];
+    void** frame_ = nullptr;  // Pushed frame (inline or in the arena)
+    size_t mark_chunk_ = 0;   // Arena position, if the frame is there
+    size_t mark_used_ = 0;
+};
+
+/**
+ * @brief RAII guard that marks the current thread GC-safe while it blocks
+ *
+ * A thread known to Julia (the init thread or an adopted thread) that blocks
+ * in C++ code must be in a GC-safe state, otherwise a collection started on
+ * another thread waits for it forever. Wrap every blocking wait with this
+ * guard. It is a no-op on threads that Julia does not know about.
+ *
+ * @note No Julia API may be called while the guard is active.
+ */
+class GCSafeRegion {
+public:
+    GCSafeRegion();
+    ~GCSafeRegion();
+
+    GCSafeRegion(const GCSafeRegion&) = delete;
+    GCSafeRegion& operator=(const GCSafeRegion&) = delete;
+
+private:
+    jl_ptls_t ptls_ = nullptr;
+    int8_t state_ = 0;
 };
 
 }  // namespace julia
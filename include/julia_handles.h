@@ -0,0 +1,116 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_HANDLES_H
+#define PHILOTE_JULIA_SERVER_JULIA_HANDLES_H
+
+#include <julia.h>
+
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "julia_layout.h"
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Cached Julia types and functions used on every request
+ *
+ * Looking up a Base function or applying a parametric type goes through a
+ * symbol lookup and, for types, the type cache. The conversion and
+ * discipline hot paths used to repeat these lookups on every call. The
+ * cache resolves them once, right after jl_init(), and memoizes functions
+ * looked up by name in Main (the discipline's compute(), etc.).
+ *
+ * All handles are permanently rooted by Julia itself (constant bindings in
+ * Base/Main, or entries in the type cache), so they need no GC protection.
+ *
+ * Owned by JuliaRuntime; see JuliaRuntime::Handles().
+ *
+ * @note Thread Safety: the Base handles are immutable once populated.
+ *       MainFunction() may be called from several executor workers.
+ */
+class JuliaHandleCache {
+public:
+    // Types
+    jl_value_t* vector_float64_type = nullptr;      // Vector{Float64}
+    jl_value_t* matrix_float64_type = nullptr;      // Matrix{Float64}
+    jl_value_t* dict_string_vector_type = nullptr;  // Dict{String, Vector{Float64}}
+    jl_value_t* dict_string_matrix_type = nullptr;  // Dict{String, Matrix{Float64}}
+    jl_value_t* dict_string_array_type = nullptr;   // Dict{String, Array{Float64}}
+    jl_value_t* dict_string_vector32_type = nullptr;  // Dict{String, Vector{Float32}}
+    jl_value_t* dict_string_array32_type = nullptr;   // Dict{String, Array{Float32}}
+    jl_value_t* dict_string_any_array_type = nullptr;  // Dict{String, Array}
+    jl_value_t* dict_string_matrix32_type = nullptr;  // Dict{String, Matrix{Float32}}
+    jl_value_t* dict_string_any_matrix_type = nullptr;  // Dict{String, Matrix}
+    jl_value_t* dict_string_range_type = nullptr;  // Dict{String, UnitRange{Int}}
+    jl_value_t* dict_pair_int_type = nullptr;  // Dict{Tuple{String, String}, Int}
+
+    /// Highest rank whose Array{T, N} types are cached
+    static constexpr size_t kMaxCachedRank = 4;
+
+    /**
+     * @brief Array{T, rank} of an element type, from the cache up to
+     *        kMaxCachedRank
+     */
+    jl_value_t* ArrayType(ElementType type, size_t rank) const {
+        size_t t = static_cast<size_t>(type);
+        return rank <= kMaxCachedRank
+                   ? array_types_[t][rank]
+                   : jl_apply_array_type(ElementJuliaType(type), rank);
+    }
+
+    /// Julia type of an element type (Float64 or Float32)
+    static jl_value_t* ElementJuliaType(ElementType type) {
+        return reinterpret_cast<jl_value_t*>(
+            type == ElementType::kFloat32 ? jl_float32_type : jl_float64_type);
+    }
+
+    // Base functions
+    jl_function_t* dict_fn = nullptr;
+    jl_function_t* setindex_fn = nullptr;
+    jl_function_t* getindex_fn = nullptr;
+    jl_function_t* getproperty_fn = nullptr;
+    jl_function_t* keys_fn = nullptr;
+    jl_function_t* collect_fn = nullptr;
+    jl_function_t* sprint_fn = nullptr;
+    jl_function_t* showerror_fn = nullptr;
+    jl_function_t* tuple_fn = nullptr;
+    jl_function_t* colon_fn = nullptr;
+
+    /**
+     * @brief Resolve the Base handles (Julia thread, after jl_init)
+     * @throws std::runtime_error if a handle cannot be resolved
+     */
+    void Populate();
+
+    /**
+     * @brief Look up a function defined in Main, memoizing the result
+     *
+     * Misses are memoized as well, so optional discipline functions cost
+     * one lookup. Invalidated whenever new code is loaded into Main.
+     *
+     * @param name Function name
+     * @return Function, or nullptr if Main does not define it
+     */
+    jl_function_t* MainFunction(const std::string& name);
+
+    /**
+     * @brief Forget memoized Main functions (after loading code into Main)
+     */
+    void InvalidateMainFunctions();
+
+private:
+    jl_value_t* array_types_[2][kMaxCachedRank + 1] = {};  // By ElementType
+    std::shared_mutex main_mutex_;
+    std::unordered_map<std::string, jl_function_t*> main_functions_;
+    uint64_t main_generation_ = 0;  // Bumped by InvalidateMainFunctions()
+};
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_HANDLES_H
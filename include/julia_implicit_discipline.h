@@ -11,6 +11,7 @@
 #include <implicit.h>
 
 #include "julia_config.h"
+#include "julia_roots.h"
 
 namespace philote {
 namespace julia {
@@ -57,7 +58,7 @@ private:
 
     DisciplineConfig config_;
     jl_module_t* module_;
-    jl_value_t* discipline_obj_;
+    JuliaRoot discipline_obj_;  // Rooted for the discipline's lifetime
     mutable std::mutex compute_mutex_;
 };
 
@@ -0,0 +1,284 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_KERNELS_H
+#define PHILOTE_JULIA_SERVER_JULIA_KERNELS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "julia_layout.h"
+
+namespace philote {
+namespace julia {
+
+/// Highest rank with its own compiled kernel; higher ranks share a generic one
+constexpr size_t kMaxKernelRank = 4;
+
+/**
+ * @brief Copy n elements, converting the element type if it differs
+ */
+template <typename Src, typename Dst>
+inline void CopyElements(const Src* src, Dst* dst, size_t n) {
+    if constexpr (std::is_same_v<Src, Dst>) {
+        if (n > 0) {
+            std::memcpy(dst, src, n * sizeof(Src));
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = static_cast<Dst>(src[i]);
+        }
+    }
+}
+
+/**
+ * @brief TransposeMatrix() for any pair of element types
+ *
+ * Double to double uses the blocked SIMD kernel; anything else converts
+ * element by element, in the same cache-sized blocks.
+ */
+template <typename Src, typename Dst>
+inline void TransposeElements(const Src* src, size_t src_stride, Dst* dst,
+                              size_t dst_stride, size_t rows, size_t cols) {
+    if constexpr (std::is_same_v<Src, double> && std::is_same_v<Dst, double>) {
+        TransposeMatrix(src, src_stride, dst, dst_stride, rows, cols);
+    } else {
+        // Destination rows are written contiguously; 16 source rows keep
+        // clear of cache set conflicts at power-of-two strides
+        constexpr size_t kBlock = 16;
+        for (size_t ib = 0; ib < rows; ib += kBlock) {
+            size_t i_end = std::min(ib + kBlock, rows);
+            for (size_t jb = 0; jb < cols; jb += kBlock) {
+                size_t j_end = std::min(jb + kBlock, cols);
+                for (size_t j = jb; j < j_end; ++j) {
+                    for (size_t i = ib; i < i_end; ++i) {
+                        dst[j * dst_stride + i] =
+                            static_cast<Dst>(src[i * src_stride + j]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Reverse the axis order of an array of compile-time rank
+ *
+ * Reads src as row-major and writes dst as column-major over the same
+ * dims, which is RowMajorToColumnMajor() with the rank (and so every
+ * stride and loop bound) fixed at compile time and no allocation. Passing
+ * the reversed dims gives the inverse.
+ *
+ * @tparam Rank Number of dimensions, all larger than 1 (>= 2)
+ * @param src Row-major data
+ * @param dst Column-major result; must not overlap src
+ * @param dims Rank dimensions
+ */
+template <size_t Rank, typename Src, typename Dst>
+void ReverseAxes(const Src* src, Dst* dst, const size_t* dims) {
+    static_assert(Rank >= 2, "rank <= 1 is a plain copy");
+    if constexpr (Rank == 2) {
+        TransposeElements(src, dims[1], dst, dims[0], dims[0], dims[1]);
+    } else {
+        size_t src_strides[Rank];
+        size_t dst_strides[Rank];
+        src_strides[Rank - 1] = 1;
+        for (size_t k = Rank - 1; k > 0; --k) {
+            src_strides[k - 1] = src_strides[k] * dims[k];
+        }
+        dst_strides[0] = 1;
+        for (size_t k = 1; k < Rank; ++k) {
+            dst_strides[k] = dst_strides[k - 1] * dims[k - 1];
+        }
+
+        // One strided transpose of the first and last axes per index of
+        // the middle axes
+        size_t index[Rank] = {};
+        size_t src_offset = 0;
+        size_t dst_offset = 0;
+        while (true) {
+            TransposeElements(src + src_offset, src_strides[0],
+                              dst + dst_offset, dst_strides[Rank - 1], dims[0],
+                              dims[Rank - 1]);
+            size_t k = Rank - 2;
+            while (k > 0 && index[k] + 1 == dims[k]) {
+                src_offset -= index[k] * src_strides[k];
+                dst_offset -= index[k] * dst_strides[k];
+                index[k] = 0;
+                --k;
+            }
+            if (k == 0) {
+                break;
+            }
+            ++index[k];
+            src_offset += src_strides[k];
+            dst_offset += dst_strides[k];
+        }
+    }
+}
+
+/**
+ * @brief ReverseAxes() for a rank known only at run time
+ *
+ * @param src Row-major data
+ * @param dst Column-major result; must not overlap src
+ * @param dims Dimensions, all larger than 1 (at least 2 of them)
+ */
+template <typename Src, typename Dst>
+void ReverseAxes(const Src* src, Dst* dst, const std::vector<size_t>& dims) {
+    size_t rank = dims.size();
+    std::vector<size_t> src_strides(rank);
+    std::vector<size_t> dst_strides(rank);
+    src_strides[rank - 1] = 1;
+    for (size_t k = rank - 1; k > 0; --k) {
+        src_strides[k - 1] = src_strides[k] * dims[k];
+    }
+    dst_strides[0] = 1;
+    for (size_t k = 1; k < rank; ++k) {
+        dst_strides[k] = dst_strides[k - 1] * dims[k - 1];
+    }
+
+    std::vector<size_t> index(rank, 0);
+    size_t src_offset = 0;
+    size_t dst_offset = 0;
+    while (true) {
+        TransposeElements(src + src_offset, src_strides[0], dst + dst_offset,
+                          dst_strides[rank - 1], dims[0], dims[rank - 1]);
+        size_t k = rank - 2;
+        while (k > 0 && index[k] + 1 == dims[k]) {
+            src_offset -= index[k] * src_strides[k];
+            dst_offset -= index[k] * dst_strides[k];
+            index[k] = 0;
+            --k;
+        }
+        if (k == 0) {
+            break;
+        }
+        ++index[k];
+        src_offset += src_strides[k];
+        dst_offset += dst_strides[k];
+    }
+}
+
+/**
+ * @brief Conversion of one variable between Philote and Julia arrays
+ *
+ * Built once per variable, when its shape, layout and element type become
+ * known (at setup, or when a reusable dict is reset), it drops the
+ * singleton dimensions and picks the kernels for the remaining rank and
+ * the Julia element type from a dispatch table: a plain copy (narrowing or
+ * widening for Float32) for column-major data and rank <= 1,
+ * ReverseAxes<2..kMaxKernelRank>, or the run-time rank ReverseAxes() above
+ * that. Each copy is then a single indirect call with no rank, layout or
+ * type branches.
+ */
+class ArrayConverter {
+public:
+    /// Float64 converter for an empty array: copies nothing
+    ArrayConverter() = default;
+
+    /**
+     * @brief Constructor
+     * @param shape Array dimensions
+     * @param layout Element order of the Philote data
+     * @param type Element type of the Julia array
+     */
+    ArrayConverter(const std::vector<size_t>& shape, ArrayLayout layout,
+                   ElementType type = ElementType::kFloat64);
+
+    /// The same conversion to or from a Julia array of another element type
+    ArrayConverter WithElementType(ElementType type) const;
+
+    /// Copy size() elements from Philote order into a Julia array's data
+    void ToJulia(const double* src, void* dst) const {
+        kernels_.to_julia(src, dst, *this);
+    }
+
+    /// Copy size() elements of a Julia array's data into Philote order
+    void FromJulia(const void* src, double* dst) const {
+        kernels_.from_julia(src, dst, *this);
+    }
+
+    /// Number of elements
+    size_t size() const { return size_; }
+
+    /// Number of dimensions larger than 1 (0 if the copy ignores the shape)
+    size_t rank() const { return dims_.size(); }
+
+    /// Element type of the Julia array
+    ElementType element_type() const { return element_type_; }
+
+    /// True if the Philote data can be used as the Julia array as is
+    bool julia_order() const {
+        return element_type_ == ElementType::kFloat64 && dims_.size() <= 1;
+    }
+
+private:
+    using ToJuliaFn = void (*)(const double* src, void* dst,
+                               const ArrayConverter& converter);
+    using FromJuliaFn = void (*)(const void* src, double* dst,
+                                 const ArrayConverter& converter);
+
+    struct Kernels {
+        ToJuliaFn to_julia;
+        FromJuliaFn from_julia;
+    };
+
+    // Kernels for the rank of dims_ and element type T
+    template <typename T>
+    static Kernels KernelsFor(size_t rank);
+
+    template <typename T>
+    static void CopyToJulia(const double* src, void* dst,
+                            const ArrayConverter& converter) {
+        CopyElements(src, static_cast<T*>(dst), converter.size_);
+    }
+
+    template <typename T>
+    static void CopyFromJulia(const void* src, double* dst,
+                              const ArrayConverter& converter) {
+        CopyElements(static_cast<const T*>(src), dst, converter.size_);
+    }
+
+    template <size_t Rank, typename T>
+    static void ToJuliaKernel(const double* src, void* dst,
+                              const ArrayConverter& converter) {
+        ReverseAxes<Rank>(src, static_cast<T*>(dst), converter.dims_.data());
+    }
+
+    template <size_t Rank, typename T>
+    static void FromJuliaKernel(const void* src, double* dst,
+                                const ArrayConverter& converter) {
+        ReverseAxes<Rank>(static_cast<const T*>(src), dst,
+                          converter.reversed_dims_.data());
+    }
+
+    template <typename T>
+    static void ToJuliaGeneric(const double* src, void* dst,
+                               const ArrayConverter& converter) {
+        ReverseAxes(src, static_cast<T*>(dst), converter.dims_);
+    }
+
+    template <typename T>
+    static void FromJuliaGeneric(const void* src, double* dst,
+                                 const ArrayConverter& converter) {
+        ReverseAxes(static_cast<const T*>(src), dst, converter.reversed_dims_);
+    }
+
+    // Pick kernels_ for dims_ and element_type_
+    void Bind();
+
+    size_t size_ = 0;
+    ElementType element_type_ = ElementType::kFloat64;
+    std::vector<size_t> dims_;           // Non-singleton dims (empty if a copy)
+    std::vector<size_t> reversed_dims_;  // dims_ in reverse, for FromJulia
+    Kernels kernels_ = {&CopyToJulia<double>, &CopyFromJulia<double>};
+};
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_KERNELS_H
@@ -0,0 +1,195 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_LAYOUT_H
+#define PHILOTE_JULIA_SERVER_JULIA_LAYOUT_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Transpose a strided matrix: dst[j * dst_stride + i] = src[i * src_stride + j]
+ *
+ * Works through the matrix in cache-sized blocks of SIMD register tiles
+ * (AVX 4x4 or SSE2/NEON 2x2, scalar otherwise), so neither side is walked
+ * with a cache-missing stride. src and dst must not overlap.
+ *
+ * @param src Source matrix, rows x cols, rows src_stride elements apart
+ * @param src_stride Distance between source rows (>= cols)
+ * @param dst Destination matrix, cols x rows, rows dst_stride elements apart
+ * @param dst_stride Distance between destination rows (>= rows)
+ * @param rows Number of source rows
+ * @param cols Number of source columns
+ */
+void TransposeMatrix(const double* src, size_t src_stride, double* dst,
+                     size_t dst_stride, size_t rows, size_t cols);
+
+/**
+ * @brief Reorder a row-major (Philote) array into column-major (Julia) order
+ *
+ * Both buffers hold the same array of the given shape, so element
+ * (i0, ..., iN) moves from row-major to column-major offset. Singleton
+ * dimensions are dropped first; what remains is a plain copy for rank <= 1,
+ * one TransposeMatrix for rank 2, and one strided TransposeMatrix of the
+ * first and last axes per index of the middle axes for higher ranks.
+ *
+ * @param src Row-major data, prod(shape) elements
+ * @param dst Column-major result, prod(shape) elements; must not overlap src
+ * @param shape Array dimensions
+ */
+void RowMajorToColumnMajor(const double* src, double* dst,
+                           const std::vector<size_t>& shape);
+
+/**
+ * @brief Inverse of RowMajorToColumnMajor
+ * @param src Column-major data, prod(shape) elements
+ * @param dst Row-major result, prod(shape) elements; must not overlap src
+ * @param shape Array dimensions
+ */
+void ColumnMajorToRowMajor(const double* src, double* dst,
+                           const std::vector<size_t>& shape);
+
+/**
+ * @brief Row-major flat index of the element at a column-major flat index
+ * @param index Column-major (Julia linear) index, 0-based
+ * @param shape Array dimensions
+ */
+size_t ColumnMajorToRowMajorIndex(size_t index,
+                                  const std::vector<size_t>& shape);
+
+/**
+ * @brief Element order of a variable's flat data on the C++ side
+ *
+ * Philote arrays are row-major by default. A column-major variable already
+ * has Julia's element order, so it crosses the boundary without permutation.
+ */
+enum class ArrayLayout {
+    kRowMajor,
+    kColumnMajor,
+};
+
+/**
+ * @brief Element type of a variable's array on the Julia side
+ *
+ * Philote variables are always double. A Float32 variable is narrowed when
+ * it is copied into Julia and widened when it is copied back, so the
+ * discipline works on (and keeps in cache) half the bytes.
+ */
+enum class ElementType {
+    kFloat64,
+    kFloat32,
+};
+
+/// Julia name of an element type ("Float64" or "Float32")
+const char* ElementTypeName(ElementType type);
+
+/// Bytes per element of an element type
+inline size_t ElementSize(ElementType type) {
+    return type == ElementType::kFloat32 ? sizeof(float) : sizeof(double);
+}
+
+/**
+ * @brief Parse "row_major" or "column_major"
+ * @throws std::runtime_error for any other name
+ */
+ArrayLayout ParseArrayLayout(const std::string& name);
+
+/// Name of a layout as accepted by ParseArrayLayout()
+const char* ArrayLayoutName(ArrayLayout layout);
+
+/**
+ * @brief Layout of each variable of a discipline
+ *
+ * Holds a discipline-wide default and per-variable overrides. Partials are
+ * looked up by their "output~input" key, then by their output variable, so
+ * a column-major output also gets column-major Jacobian blocks unless a
+ * block says otherwise. Variables also carry their Julia element type,
+ * Float64 unless set.
+ */
+class ArrayLayoutMap {
+public:
+    ArrayLayoutMap() = default;
+
+    /**
+     * @brief Constructor
+     * @param default_layout Layout of variables without an override
+     */
+    explicit ArrayLayoutMap(ArrayLayout default_layout)
+        : default_layout_(default_layout) {}
+
+    /// Override the layout of one variable (or "output~input" partial)
+    void Set(const std::string& name, ArrayLayout layout) {
+        layouts_[name] = layout;
+    }
+
+    /// Layout of a variable
+    ArrayLayout Get(const std::string& name) const {
+        auto it = layouts_.find(name);
+        return it != layouts_.end() ? it->second : default_layout_;
+    }
+
+    /// Layout of the partial of output with respect to input
+    ArrayLayout GetPartial(const std::string& output,
+                           const std::string& input) const {
+        auto it = layouts_.find(output + "~" + input);
+        return it != layouts_.end() ? it->second : Get(output);
+    }
+
+    /// Layout of variables without an override
+    ArrayLayout default_layout() const { return default_layout_; }
+
+    /// Names with an override, variables and "output~input" partials alike
+    std::vector<std::string> OverriddenNames() const {
+        std::vector<std::string> names;
+        names.reserve(layouts_.size());
+        for (const auto& [name, layout] : layouts_) {
+            names.push_back(name);
+        }
+        return names;
+    }
+
+    /// Set the Julia element type of one variable
+    void SetElementType(const std::string& name, ElementType type) {
+        if (type == ElementType::kFloat64) {
+            element_types_.erase(name);
+        } else {
+            element_types_[name] = type;
+        }
+    }
+
+    /// Julia element type of a variable
+    ElementType GetElementType(const std::string& name) const {
+        auto it = element_types_.find(name);
+        return it != element_types_.end() ? it->second : ElementType::kFloat64;
+    }
+
+    /// True if some variable is not Float64
+    bool has_element_types() const { return !element_types_.empty(); }
+
+private:
+    ArrayLayout default_layout_ = ArrayLayout::kRowMajor;
+    std::map<std::string, ArrayLayout> layouts_;
+    std::map<std::string, ElementType> element_types_;
+};
+
+/**
+ * @brief Copy an array of the given layout into Julia (column-major) order
+ *
+ * A plain copy for column-major data, RowMajorToColumnMajor() otherwise.
+ */
+void CopyToJuliaOrder(const double* src, double* dst,
+                      const std::vector<size_t>& shape, ArrayLayout layout);
+
+/// Inverse of CopyToJuliaOrder()
+void CopyFromJuliaOrder(const double* src, double* dst,
+                        const std::vector<size_t>& shape, ArrayLayout layout);
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_LAYOUT_H
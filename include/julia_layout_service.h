@@ -0,0 +1,60 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_LAYOUT_SERVICE_H
+#define PHILOTE_JULIA_SERVER_JULIA_LAYOUT_SERVICE_H
+
+#include <memory>
+#include <vector>
+
+#include <variable.h>
+
+#include "julia_explicit_discipline.h"
+#include "julia_layout.h"
+#include "layout.grpc.pb.h"
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Reports the array layout of each variable of an explicit discipline
+ *
+ * Philote's variable metadata has no notion of element order, so clients
+ * of a discipline with column-major variables query this service (see
+ * proto/layout.proto) to learn which inputs to send, and which outputs and
+ * partials to read, in column-major order.
+ */
+class JuliaLayoutService final : public ArrayLayoutService::Service {
+public:
+    /**
+     * @brief Constructor
+     * @param discipline Discipline to describe (kept alive by the service)
+     */
+    explicit JuliaLayoutService(
+        std::shared_ptr<JuliaExplicitDiscipline> discipline);
+
+    grpc::Status GetVariableLayouts(grpc::ServerContext* context,
+                                    const VariableLayoutsRequest* request,
+                                    VariableLayoutsResponse* response) override;
+
+private:
+    std::shared_ptr<JuliaExplicitDiscipline> discipline_;
+};
+
+/**
+ * @brief Describe the layout of every variable and declared partial
+ *
+ * @param vars Variable metadata of the discipline
+ * @param partials Declared partials of the discipline
+ * @param layouts Layout of each variable
+ * @param response Receives one entry per input, output and partial
+ */
+void DescribeVariableLayouts(const std::vector<philote::VariableMetaData>& vars,
+                             const std::vector<philote::PartialsMetaData>& partials,
+                             const ArrayLayoutMap& layouts,
+                             VariableLayoutsResponse* response);
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_LAYOUT_SERVICE_H
@@ -0,0 +1,76 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_MULTIPOINT_SERVICE_H
+#define PHILOTE_JULIA_SERVER_JULIA_MULTIPOINT_SERVICE_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <variable.h>
+
+#include "julia_explicit_discipline.h"
+#include "multipoint.grpc.pb.h"
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Multi-point evaluation service for explicit disciplines
+ *
+ * Design-of-experiments and population-based optimizers evaluate many
+ * small design points. Through Philote's ExplicitService each point is a
+ * separate streaming RPC with its own conversion and executor round trip.
+ * ComputeFunctionMultiPoint takes N input sets in one unary request and
+ * returns N output sets in one response: the points are evaluated in a
+ * single executor task, through compute_batch() with column-stacked arrays
+ * when the discipline defines it, or by looping compute() otherwise.
+ *
+ * Served alongside the Philote services (see proto/multipoint.proto).
+ */
+class JuliaMultiPointService final : public MultiPointService::Service {
+public:
+    /**
+     * @brief Constructor
+     * @param discipline Discipline to evaluate (kept alive by the service)
+     * @param max_points Largest num_points a request may ask for (>= 1)
+     */
+    JuliaMultiPointService(std::shared_ptr<JuliaExplicitDiscipline> discipline,
+                           size_t max_points);
+
+    grpc::Status ComputeFunctionMultiPoint(
+        grpc::ServerContext* context, const MultiPointRequest* request,
+        MultiPointResponse* response) override;
+
+private:
+    std::shared_ptr<JuliaExplicitDiscipline> discipline_;
+    size_t max_points_;
+};
+
+/**
+ * @brief Split a multi-point request into one Variables map per point
+ *
+ * @param request Stacked inputs
+ * @param templates One variable per expected input, with its shape
+ * @return request.num_points() input sets shaped like templates
+ * @throws std::runtime_error if an input is missing, unknown, or sized
+ *         inconsistently with num_points and its shape
+ */
+std::vector<philote::Variables> UnpackMultiPointInputs(
+    const MultiPointRequest& request, const philote::Variables& templates);
+
+/**
+ * @brief Stack per-point outputs into a multi-point response
+ *
+ * @param outputs One Variables map per point; all with the same shapes
+ * @param response Receives num_points and one StackedVariable per output
+ * @throws std::runtime_error if the points' outputs do not match
+ */
+void PackMultiPointOutputs(const std::vector<philote::Variables>& outputs,
+                           MultiPointResponse* response);
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_MULTIPOINT_SERVICE_H
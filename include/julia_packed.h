@@ -0,0 +1,78 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_PACKED_H
+#define PHILOTE_JULIA_SERVER_JULIA_PACKED_H
+
+#include <string>
+#include <vector>
+
+#include <variable.h>
+
+#include "julia_kernels.h"
+#include "julia_layout.h"
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Location of one variable in a packed buffer
+ */
+struct PackedSlot {
+    std::string name;
+    size_t offset = 0;  ///< First element, 0-based
+    size_t size = 0;    ///< Number of elements
+    std::vector<size_t> shape;
+    ArrayLayout layout = ArrayLayout::kRowMajor;
+    ArrayConverter converter;  ///< Chosen from shape and layout at setup
+};
+
+/**
+ * @brief Name-to-offset table of a packed buffer
+ *
+ * Slots are sorted by name, like philote::Variables, and laid out back to
+ * back. Each variable is stored in Julia's column-major order, so Julia
+ * can reshape its range of the buffer directly.
+ */
+struct PackedIndex {
+    std::vector<PackedSlot> slots;
+    size_t size = 0;  ///< Total number of elements
+};
+
+/**
+ * @brief Build the packed index of a discipline's inputs or outputs
+ *
+ * @param vars Variable metadata of the discipline
+ * @param type Which variables to include (kInput or kOutput)
+ * @param layouts Element order of each variable on the C++ side
+ * @return Packed index
+ */
+PackedIndex MakePackedIndex(const std::vector<philote::VariableMetaData>& vars,
+                            philote::VariableType type,
+                            const ArrayLayoutMap& layouts);
+
+/**
+ * @brief Copy variables into a packed buffer
+ *
+ * @param vars Exactly the variables of the index
+ * @param index Packed index
+ * @param buffer Destination of index.size elements
+ * @throws std::runtime_error if a variable is missing, extra or mis-sized
+ */
+void PackVariables(const philote::Variables& vars, const PackedIndex& index,
+                   double* buffer);
+
+/**
+ * @brief Copy a packed buffer out into variables
+ *
+ * @param buffer Source of index.size elements
+ * @param index Packed index
+ * @return One variable per slot
+ */
+philote::Variables UnpackVariables(const double* buffer,
+                                   const PackedIndex& index);
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_PACKED_H
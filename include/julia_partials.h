@@ -0,0 +1,61 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_PARTIALS_H
+#define PHILOTE_JULIA_SERVER_JULIA_PARTIALS_H
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <variable.h>
+
+#include "julia_kernels.h"
+#include "julia_layout.h"
+#include "julia_sparse.h"
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief One entry of the partials block index table
+ *
+ * Everything needed to turn the values Julia returns for a block into a
+ * Philote partial, resolved once at setup.
+ */
+struct PartialsBlock {
+    std::pair<std::string, std::string> key;  ///< (output, input)
+    std::vector<size_t> shape;  ///< Output shape, then input shape
+    size_t size = 0;            ///< Number of dense entries
+    ArrayLayout layout = ArrayLayout::kRowMajor;
+    ArrayConverter converter;  ///< Dense blocks only
+    std::shared_ptr<const SparsityPattern> pattern;  ///< Null if dense
+};
+
+/// Declared partials in Philote Partials key order; Julia block k is entry k-1
+using PartialsBlockTable = std::vector<PartialsBlock>;
+
+/**
+ * @brief Build the block index table of a discipline's declared partials
+ *
+ * Blocks are sorted like the keys of philote::Partials, so results can be
+ * appended to a Partials map in table order, and a partial declared more
+ * than once appears once.
+ *
+ * @param vars Variable metadata of the discipline
+ * @param partials Declared partials
+ * @param layouts Layout of each variable and partial
+ * @param patterns Sparsity pattern of each sparse partial
+ * @return Block index table
+ * @throws std::runtime_error if a partial refers to an unknown variable
+ */
+PartialsBlockTable MakePartialsBlockTable(
+    const std::vector<philote::VariableMetaData>& vars,
+    const std::vector<philote::PartialsMetaData>& partials,
+    const ArrayLayoutMap& layouts, const SparsityPatterns& patterns);
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_PARTIALS_H
@@ -0,0 +1,154 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_ROOTS_H
+#define PHILOTE_JULIA_SERVER_JULIA_ROOTS_H
+
+#include <julia.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Slots that keep Julia objects alive for as long as C++ holds them
+ *
+ * Discipline objects, reusable dicts, compiled functions and per-worker
+ * buffers outlive any GC frame. Instead of binding each of them to its own
+ * global in Main, they take a slot in this pool: fixed-size Vector{Any}
+ * chunks held by a single rooted vector, the only global the pool defines.
+ * Acquire() and Release() are O(1) through a free list; Get() and Set() on
+ * a held slot take no lock, since chunks never move once allocated.
+ *
+ * Owned by JuliaRuntime; see JuliaRuntime::Roots(). Most code holds slots
+ * through JuliaRoot rather than calling the pool directly.
+ *
+ * @note Thread Safety: all methods may be called concurrently. Acquire()
+ *       and Set() write Julia objects and must run on a Julia thread;
+ *       Release() may run on any thread. No Julia allocation happens under
+ *       the pool's lock, so waiting on it never holds up a collection.
+ */
+class JuliaRootPool {
+public:
+    /// Slot index meaning "no slot"
+    static constexpr size_t kNoSlot = static_cast<size_t>(-1);
+
+    /// Slots per Vector{Any} chunk
+    static constexpr size_t kChunkSlots = 256;
+
+    /// Chunks the pool may grow to (kMaxChunks * kChunkSlots roots)
+    static constexpr size_t kMaxChunks = 1024;
+
+    /**
+     * @brief Create the root vector (Julia thread, after jl_init)
+     */
+    void Initialize();
+
+    /**
+     * @brief Take a free slot, rooting obj in it
+     * @param obj Object to root (may be null to reserve the slot)
+     * @return Slot index
+     * @throws std::runtime_error if the pool is full or not initialized
+     */
+    size_t Acquire(jl_value_t* obj = nullptr);
+
+    /**
+     * @brief Unroot a slot's object and return the slot to the free list
+     * @param slot Slot from Acquire(); kNoSlot is ignored
+     */
+    void Release(size_t slot);
+
+    /// Object rooted in a held slot (null if none)
+    jl_value_t* Get(size_t slot) const {
+        return Data(slot)[slot % kChunkSlots];
+    }
+
+    /// Root obj in a held slot in place of its current object
+    void Set(size_t slot, jl_value_t* obj) {
+        jl_array_ptr_set(chunks_[slot / kChunkSlots].load(
+                             std::memory_order_acquire),
+                         slot % kChunkSlots, obj);
+    }
+
+    /// Number of slots currently held
+    size_t size() const;
+
+private:
+    jl_value_t** Data(size_t slot) const {
+        return jl_array_data(
+            chunks_[slot / kChunkSlots].load(std::memory_order_acquire),
+            jl_value_t*);
+    }
+
+    jl_array_t* root_ = nullptr;  // Vector{Any} of the chunks, in Main
+    std::array<std::atomic<jl_array_t*>, kMaxChunks> chunks_{};
+    size_t num_chunks_ = 0;
+    std::vector<size_t> free_;  // Released slots below the high-water mark
+    size_t next_ = 0;           // Slots never handed out start here
+    mutable std::mutex mutex_;
+};
+
+/**
+ * @brief Owner of one JuliaRootPool slot
+ *
+ * Roots an object for the lifetime of the JuliaRoot (or until Reset()),
+ * like a GCProtect that is not tied to a scope and can be stored in a
+ * class or container:
+ *
+ * @code
+ * JuliaRoot discipline(jl_call0(type));  // rooted until destroyed
+ * jl_call1(setup_fn, discipline.get());
+ * @endcode
+ *
+ * Movable, not copyable.
+ */
+class JuliaRoot {
+public:
+    /// Holds no slot and no object
+    JuliaRoot() = default;
+
+    /// Root obj in a slot of the runtime's pool
+    explicit JuliaRoot(jl_value_t* obj);
+
+    ~JuliaRoot() { Reset(); }
+
+    JuliaRoot(JuliaRoot&& other) noexcept : slot_(other.slot_) {
+        other.slot_ = JuliaRootPool::kNoSlot;
+    }
+
+    JuliaRoot& operator=(JuliaRoot&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            slot_ = other.slot_;
+            other.slot_ = JuliaRootPool::kNoSlot;
+        }
+        return *this;
+    }
+
+    JuliaRoot(const JuliaRoot&) = delete;
+    JuliaRoot& operator=(const JuliaRoot&) = delete;
+
+    /// Rooted object, or null
+    jl_value_t* get() const;
+
+    /// Root obj instead, taking a slot on first use
+    void Set(jl_value_t* obj);
+
+    /// Unroot the object and give the slot back
+    void Reset();
+
+    explicit operator bool() const { return get() != nullptr; }
+
+private:
+    size_t slot_ = JuliaRootPool::kNoSlot;
+};
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_ROOTS_H
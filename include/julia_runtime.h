@@ -9,9 +9,22 @@
 #include <mutex>
 #include <string>
 
+#include "julia_handles.h"
+#include "julia_roots.h"
+
 namespace philote {
 namespace julia {
 
+/**
+ * @brief Options applied when the Julia runtime is first initialized
+ */
+struct JuliaRuntimeOptions {
+    // Julia's own threads (JULIA_NUM_THREADS), for Threads.@spawn inside
+    // disciplines. Executor workers are adopted and need none of these.
+    int num_threads = 1;
+    std::string sysimage;  // System image to start from ("" = Julia's default)
+};
+
 /**
  * @brief Singleton class managing Julia runtime initialization and shutdown
  *
@@ -30,6 +43,17 @@ public:
      */
     static JuliaRuntime& GetInstance();
 
+    /**
+     * @brief Set options for runtime initialization
+     *
+     * Must be called before the first GetInstance(), since Julia reads its
+     * thread count and system image only once, during initialization.
+     *
+     * @param options Runtime options
+     * @throws std::runtime_error if Julia has already been initialized
+     */
+    static void Configure(const JuliaRuntimeOptions& options);
+
     /**
      * @brief Check if Julia has been initialized
      * @return true if Julia is initialized, false otherwise
@@ -48,6 +72,18 @@ public:
      */
     jl_module_t* GetBaseModule() const { return jl_base_module; }
 
+    /**
+     * @brief Cached types and functions for the conversion and call paths
+     * Populated right after jl_init(); Main functions are memoized lazily.
+     */
+    JuliaHandleCache& Handles() { return handles_; }
+
+    /**
+     * @brief Pool of long-lived GC roots (discipline objects, cached dicts,
+     *        buffers); created right after jl_init()
+     */
+    JuliaRootPool& Roots() { return roots_; }
+
     /**
      * @brief Load a Julia source file
      * @param filepath Absolute path to .jl file
@@ -82,7 +118,11 @@ private:
     JuliaRuntime();
 
     std::atomic<bool> initialized_{false};
+    JuliaHandleCache handles_;
+    JuliaRootPool roots_;
     static std::once_flag init_flag_;
+    static JuliaRuntimeOptions options_;
+    static std::atomic<bool> constructed_;
 };
 
 }  // namespace julia
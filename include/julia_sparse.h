@@ -0,0 +1,94 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_SPARSE_H
+#define PHILOTE_JULIA_SERVER_JULIA_SPARSE_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <variable.h>
+
+#include "julia_layout.h"
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Nonzero positions of one Jacobian block d(output)/d(input)
+ *
+ * Indices are 0-based flat offsets into the output (rows) and input (cols)
+ * in the element order of the partial's layout, so the dense block is
+ * indexed row * input_size + col when row-major and row + col * output_size
+ * when column-major.
+ */
+struct SparsityPattern {
+    std::vector<size_t> shape;  ///< Dense block shape: output, then input dims
+    size_t output_size = 0;     ///< Number of output elements (block rows)
+    size_t input_size = 0;      ///< Number of input elements (block columns)
+    ArrayLayout layout = ArrayLayout::kRowMajor;
+    std::vector<size_t> rows;
+    std::vector<size_t> cols;
+
+    /// Number of stored entries
+    size_t nnz() const { return rows.size(); }
+};
+
+/// Sparsity patterns keyed by (output, input)
+using SparsityPatterns =
+    std::map<std::pair<std::string, std::string>,
+             std::shared_ptr<const SparsityPattern>>;
+
+/**
+ * @brief Stored entries of one sparse Jacobian block
+ */
+struct SparsePartial {
+    std::shared_ptr<const SparsityPattern> pattern;
+    std::vector<double> values;  ///< values[k] sits at (rows[k], cols[k])
+};
+
+/// Sparse partials keyed by (output, input)
+using SparsePartials =
+    std::map<std::pair<std::string, std::string>, SparsePartial>;
+
+/**
+ * @brief Build a pattern from the index vectors declared in Julia
+ *
+ * Julia declares entries with 1-based linear indices into the output and
+ * input arrays (LinearIndices, i.e. column-major). They are converted to
+ * 0-based flat offsets in the partial's layout.
+ *
+ * @param rows Julia linear indices into the output
+ * @param cols Julia linear indices into the input
+ * @param nnz Length of rows and cols
+ * @param output_shape Shape of the output variable
+ * @param input_shape Shape of the input variable
+ * @param layout Layout of the partial
+ * @return Pattern with the converted indices
+ * @throws std::runtime_error if an index is out of range
+ */
+SparsityPattern MakeSparsityPattern(const int64_t* rows, const int64_t* cols,
+                                    size_t nnz,
+                                    const std::vector<size_t>& output_shape,
+                                    const std::vector<size_t>& input_shape,
+                                    ArrayLayout layout);
+
+/**
+ * @brief Scatter a sparse block into a dense Philote partial
+ *
+ * Used where a client can only receive dense Jacobians (Philote's
+ * ComputeGradient); unstored entries are zero.
+ *
+ * @param partial Sparse block
+ * @return Dense partial shaped like the pattern
+ */
+philote::Variable DensifyPartial(const SparsePartial& partial);
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_SPARSE_H
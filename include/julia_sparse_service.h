@@ -0,0 +1,72 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_SPARSE_SERVICE_H
+#define PHILOTE_JULIA_SERVER_JULIA_SPARSE_SERVICE_H
+
+#include <memory>
+
+#include <variable.h>
+
+#include "julia_explicit_discipline.h"
+#include "julia_sparse.h"
+#include "sparse.grpc.pb.h"
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Sparse gradient service for explicit disciplines
+ *
+ * Philote's ComputeGradient streams every partial as a dense array, so a
+ * Jacobian that is almost entirely zero costs its full dense size on the
+ * wire. ComputeGradientSparse returns the partials declared sparse in
+ * setup_partials!() as (rows, cols, values) blocks, exactly as
+ * compute_partials() produced them, and the others densely.
+ *
+ * Served alongside the Philote services (see proto/sparse.proto).
+ */
+class JuliaSparseGradientService final : public SparseGradientService::Service {
+public:
+    /**
+     * @brief Constructor
+     * @param discipline Discipline to differentiate (kept alive by the service)
+     */
+    explicit JuliaSparseGradientService(
+        std::shared_ptr<JuliaExplicitDiscipline> discipline);
+
+    grpc::Status ComputeGradientSparse(
+        grpc::ServerContext* context, const SparseGradientRequest* request,
+        SparseGradientResponse* response) override;
+
+private:
+    std::shared_ptr<JuliaExplicitDiscipline> discipline_;
+};
+
+/**
+ * @brief Fill input variables from a sparse gradient request
+ *
+ * @param request Flat inputs
+ * @param templates One variable per expected input, with its shape
+ * @return Inputs shaped like templates
+ * @throws std::runtime_error if an input is missing, unknown, or has the
+ *         wrong number of values
+ */
+philote::Variables UnpackSparseGradientInputs(
+    const SparseGradientRequest& request, const philote::Variables& templates);
+
+/**
+ * @brief Add dense and sparse partials to a sparse gradient response
+ *
+ * @param dense Partials without a sparsity pattern
+ * @param sparse Stored entries of the sparse partials
+ * @param response Receives one JacobianBlock per partial
+ */
+void PackSparseGradient(const philote::Partials& dense,
+                        const SparsePartials& sparse,
+                        SparseGradientResponse* response);
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_SPARSE_SERVICE_H
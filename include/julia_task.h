@@ -0,0 +1,443 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_TASK_H
+#define PHILOTE_JULIA_SERVER_JULIA_TASK_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "julia_gc.h"
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Move-only type-erased `void()` callable with inline storage
+ *
+ * Callables up to kInlineSize bytes that are nothrow-movable are stored in
+ * the object itself, so wrapping them never allocates. Larger callables
+ * fall back to the heap.
+ */
+class Task {
+public:
+    static constexpr size_t kInlineSize = 48;
+
+    Task() noexcept = default;
+
+    template<typename Func,
+             typename = std::enable_if_t<
+                 !std::is_same_v<std::decay_t<Func>, Task>>>
+    Task(Func&& func) {  // NOLINT: implicit by design, like std::function
+        using Callable = std::decay_t<Func>;
+        if constexpr (FitsInline<Callable>()) {
+            ::new (static_cast<void*>(storage_))
+                Callable(std::forward<Func>(func));
+            ops_ = &InlineOps<Callable>::kOps;
+        } else {
+            *reinterpret_cast<Callable**>(storage_) =
+                new Callable(std::forward<Func>(func));
+            ops_ = &HeapOps<Callable>::kOps;
+        }
+    }
+
+    Task(Task&& other) noexcept { MoveFrom(other); }
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() { Reset(); }
+
+    /**
+     * @brief Invoke the stored callable
+     */
+    void operator()() { ops_->invoke(storage_); }
+
+    explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+private:
+    struct Ops {
+        void (*invoke)(void* storage);
+        void (*move)(void* dst, void* src) noexcept;
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template<typename Callable>
+    static constexpr bool FitsInline() {
+        return sizeof(Callable) <= kInlineSize &&
+               alignof(Callable) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<Callable>;
+    }
+
+    template<typename Callable>
+    struct InlineOps {
+        static Callable* Get(void* storage) {
+            return std::launder(static_cast<Callable*>(storage));
+        }
+        static void Invoke(void* storage) { (*Get(storage))(); }
+        static void Move(void* dst, void* src) noexcept {
+            ::new (dst) Callable(std::move(*Get(src)));
+            Get(src)->~Callable();
+        }
+        static void Destroy(void* storage) noexcept { Get(storage)->~Callable(); }
+        static constexpr Ops kOps = {&Invoke, &Move, &Destroy};
+    };
+
+    template<typename Callable>
+    struct HeapOps {
+        static Callable*& Get(void* storage) {
+            return *static_cast<Callable**>(storage);
+        }
+        static void Invoke(void* storage) { (*Get(storage))(); }
+        static void Move(void* dst, void* src) noexcept {
+            *static_cast<Callable**>(dst) = Get(src);
+            Get(src) = nullptr;
+        }
+        static void Destroy(void* storage) noexcept { delete Get(storage); }
+        static constexpr Ops kOps = {&Invoke, &Move, &Destroy};
+    };
+
+    void MoveFrom(Task& other) noexcept {
+        if (other.ops_) {
+            other.ops_->move(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    void Reset() noexcept {
+        if (ops_) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[kInlineSize];
+    const Ops* ops_ = nullptr;
+};
+
+/**
+ * @brief Stack-resident result slot for a task whose submitter blocks
+ *
+ * Replaces std::promise/std::future for the blocking Submit path: the
+ * result or exception lives in the submitter's frame and completion is
+ * signalled through an atomic wait, so no shared state is allocated.
+ *
+ * @tparam T Result type (void allowed)
+ */
+template<typename T>
+class CompletionSlot {
+public:
+    CompletionSlot() = default;
+    CompletionSlot(const CompletionSlot&) = delete;
+    CompletionSlot& operator=(const CompletionSlot&) = delete;
+
+    /**
+     * @brief Run func, capture its result or exception, and wake the waiter
+     */
+    template<typename Func>
+    void Run(Func& func) {
+        try {
+            if constexpr (std::is_void_v<T>) {
+                func();
+                value_.emplace();
+            } else {
+                value_.emplace(func());
+            }
+        } catch (...) {
+            exception_ = std::current_exception();
+        }
+
+        // Only notify when the waiter has gone to sleep. A sleeping waiter
+        // does not return until notified_ is set, so the slot is still
+        // alive for notify_one; notified_ is the last member touched here.
+        if (state_.exchange(kDone, std::memory_order_acq_rel) == kSleeping) {
+            state_.notify_one();
+            notified_.store(true, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Block until Run() has finished, then return or rethrow
+     */
+    T Get() {
+        Wait();
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+        if constexpr (!std::is_void_v<T>) {
+            return std::move(*value_);
+        }
+    }
+
+private:
+    static constexpr uint32_t kPending = 0;
+    static constexpr uint32_t kSleeping = 1;
+    static constexpr uint32_t kDone = 2;
+    static constexpr int kSpinIterations = 1024;
+
+    struct Empty {};
+    using Stored = std::conditional_t<std::is_void_v<T>, Empty, T>;
+
+    void Wait() {
+        for (int i = 0; i < kSpinIterations; ++i) {
+            if (state_.load(std::memory_order_acquire) == kDone) {
+                return;
+            }
+        }
+
+        uint32_t expected = kPending;
+        if (!state_.compare_exchange_strong(expected, kSleeping,
+                                            std::memory_order_acq_rel)) {
+            return;  // Finished meanwhile; Run() will not notify
+        }
+        expected = kSleeping;
+        while (expected != kDone) {
+            state_.wait(expected, std::memory_order_acquire);
+            expected = state_.load(std::memory_order_acquire);
+        }
+
+        // Run() saw us asleep and is about to notify; stay alive until it
+        // has (a spurious wake-up can get here first)
+        while (!notified_.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::atomic<uint32_t> state_{kPending};
+    std::atomic<bool> notified_{false};  // Run() is done with the slot
+    std::optional<Stored> value_;
+    std::exception_ptr exception_;
+};
+
+/**
+ * @brief Shared completion state behind a TaskHandle
+ *
+ * Owned jointly by the queued task and the handle. Exactly one consumer
+ * may observe completion: a blocking Get(), or one continuation.
+ */
+template<typename T>
+class AsyncCompletion {
+public:
+    /**
+     * @brief Run func, capture its result or exception, then wake the
+     *        blocked waiter or run the registered continuation
+     */
+    template<typename Func>
+    void Run(Func& func) {
+        try {
+            if constexpr (std::is_void_v<T>) {
+                func();
+                value_.emplace();
+            } else {
+                value_.emplace(func());
+            }
+        } catch (...) {
+            exception_ = std::current_exception();
+        }
+
+        uint32_t previous = state_.exchange(kDone, std::memory_order_acq_rel);
+        if (previous == kSleeping) {
+            state_.notify_one();
+        } else if (previous == kContinuation) {
+            // Move out first so captures (possibly this handle) are released
+            Task continuation = std::move(continuation_);
+            RunContinuation(continuation);
+        }
+    }
+
+    /**
+     * @brief Run a continuation, keeping its exception from escaping
+     *
+     * Continuations run on the executor worker, which has no caller to
+     * receive an exception; it is kept for ContinuationException() instead.
+     */
+    void RunContinuation(Task& continuation) noexcept {
+        try {
+            continuation();
+        } catch (...) {
+            continuation_exception_ = std::current_exception();
+            continuation_failed_.store(true, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Exception thrown by the continuation, if it has thrown
+     */
+    std::exception_ptr ContinuationException() const {
+        if (!continuation_failed_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return continuation_exception_;
+    }
+
+    bool Done() const {
+        return state_.load(std::memory_order_acquire) == kDone;
+    }
+
+    /**
+     * @brief Register a continuation to run on completion
+     * @param continuation Moved from on success; left intact on failure
+     * @return false if already complete (the caller should run it)
+     */
+    bool SetContinuation(Task& continuation) {
+        continuation_ = std::move(continuation);
+        uint32_t expected = kPending;
+        if (state_.compare_exchange_strong(expected, kContinuation,
+                                           std::memory_order_acq_rel)) {
+            return true;
+        }
+        continuation = std::move(continuation_);
+        return false;
+    }
+
+    void Wait() {
+        uint32_t expected = kPending;
+        if (state_.compare_exchange_strong(expected, kSleeping,
+                                           std::memory_order_acq_rel)) {
+            expected = kSleeping;
+        }
+        while (expected != kDone) {
+            state_.wait(expected, std::memory_order_acquire);
+            expected = state_.load(std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Return the result or rethrow; requires Done()
+     */
+    T Take() {
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+        if constexpr (!std::is_void_v<T>) {
+            return std::move(*value_);
+        }
+    }
+
+private:
+    static constexpr uint32_t kPending = 0;
+    static constexpr uint32_t kSleeping = 1;
+    static constexpr uint32_t kContinuation = 2;
+    static constexpr uint32_t kDone = 3;
+
+    struct Empty {};
+    using Stored = std::conditional_t<std::is_void_v<T>, Empty, T>;
+
+    std::atomic<uint32_t> state_{kPending};
+    std::optional<Stored> value_;
+    std::exception_ptr exception_;
+    Task continuation_;
+    std::atomic<bool> continuation_failed_{false};
+    std::exception_ptr continuation_exception_;
+};
+
+/**
+ * @brief Handle to the result of JuliaExecutor::SubmitAsync
+ *
+ * The result can be consumed once, in one of three ways:
+ * - Get(): block until the task has run
+ * - OnComplete(callback): run callback on the executor worker when done
+ *   (immediately on the calling thread if already done)
+ * - co_await handle: suspend a C++20 coroutine until the task has run
+ *
+ * A coroutine awaiting a handle resumes on the executor worker that ran
+ * the task. It should reach its next suspension point (or hand work off,
+ * e.g. to a gRPC completion queue) promptly, and must not call the blocking
+ * JuliaExecutor::Submit() before doing so.
+ *
+ * @tparam T Result type (void allowed)
+ */
+template<typename T>
+class TaskHandle {
+public:
+    TaskHandle() = default;
+    explicit TaskHandle(std::shared_ptr<AsyncCompletion<T>> state)
+        : state_(std::move(state)) {}
+
+    /**
+     * @brief Whether the handle refers to a submitted task
+     */
+    bool Valid() const { return state_ != nullptr; }
+
+    /**
+     * @brief Non-blocking completion check
+     */
+    bool Ready() const { return state_->Done(); }
+
+    /**
+     * @brief Block until the task completes, then return or rethrow
+     */
+    T Get() {
+        if (!state_->Done()) {
+            GCSafeRegion gc_safe;
+            state_->Wait();
+        }
+        return state_->Take();
+    }
+
+    /**
+     * @brief Run callback once the task completes
+     *
+     * The callback runs on the executor worker, or immediately on the
+     * calling thread if the task has already finished. It receives no
+     * arguments; call Get() from it to obtain the (ready) result. An
+     * exception thrown by the callback does not propagate on either
+     * thread; it is reported by CallbackException().
+     */
+    void OnComplete(Task callback) {
+        if (!state_->SetContinuation(callback)) {
+            state_->RunContinuation(callback);
+        }
+    }
+
+    /**
+     * @brief Exception thrown by the OnComplete callback
+     * @return nullptr until the callback has thrown
+     */
+    std::exception_ptr CallbackException() const {
+        return state_->ContinuationException();
+    }
+
+    auto operator co_await() noexcept {
+        struct Awaiter {
+            AsyncCompletion<T>* state;
+
+            bool await_ready() const noexcept { return state->Done(); }
+
+            bool await_suspend(std::coroutine_handle<> handle) {
+                // false: the task finished meanwhile, resume immediately
+                Task resume([handle]() mutable { handle.resume(); });
+                return state->SetContinuation(resume);
+            }
+
+            T await_resume() { return state->Take(); }
+        };
+        return Awaiter{state_.get()};
+    }
+
+private:
+    std::shared_ptr<AsyncCompletion<T>> state_;
+};
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_TASK_H
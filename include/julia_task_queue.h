@@ -0,0 +1,130 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_TASK_QUEUE_H
+#define PHILOTE_JULIA_SERVER_JULIA_TASK_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Bounded lock-free multi-producer/single-consumer ring buffer
+ *
+ * Each slot carries a sequence number that tells producers whether the slot
+ * is free and tells the consumer whether it has been published (Vyukov's
+ * bounded queue). Producers claim slots with a single CAS on the tail; the
+ * single consumer owns the head and never contends.
+ *
+ * @tparam T Element type; must be default-constructible and move-assignable
+ *
+ * @note Thread Safety: TryPush() may be called from any number of threads.
+ *       TryPop() and Empty() must only be called from the one consumer.
+ */
+template<typename T>
+class MpscRingQueue {
+public:
+    /**
+     * @brief Construct a queue
+     * @param capacity Minimum number of slots (rounded up to a power of two)
+     */
+    explicit MpscRingQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mask_ = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingQueue(const MpscRingQueue&) = delete;
+    MpscRingQueue& operator=(const MpscRingQueue&) = delete;
+
+    /**
+     * @brief Append an element
+     * @param value Element to move into the queue (untouched on failure)
+     * @return false if the queue is full
+     */
+    bool TryPush(T&& value) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff =
+                static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // Slot still holds an unconsumed element
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest element (consumer only)
+     * @param value Receives the element
+     * @return false if the queue is empty
+     */
+    bool TryPop(T& value) {
+        Cell& cell = cells_[dequeue_pos_ & mask_];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if (seq != dequeue_pos_ + 1) {
+            return false;
+        }
+
+        value = std::move(cell.value);
+        cell.value = T();
+        cell.sequence.store(dequeue_pos_ + mask_ + 1,
+                            std::memory_order_release);
+        ++dequeue_pos_;
+        return true;
+    }
+
+    /**
+     * @brief Check whether a published element is waiting (consumer only)
+     */
+    bool Empty() const {
+        const Cell& cell = cells_[dequeue_pos_ & mask_];
+        return cell.sequence.load(std::memory_order_acquire) !=
+               dequeue_pos_ + 1;
+    }
+
+    /**
+     * @brief Number of slots
+     */
+    size_t Capacity() const { return mask_ + 1; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};
+    alignas(64) size_t dequeue_pos_ = 0;
+};
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_TASK_QUEUE_H
@@ -0,0 +1,193 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_TELEMETRY_H
+#define PHILOTE_JULIA_SERVER_JULIA_TELEMETRY_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Point-in-time copy of a Histogram
+ */
+struct HistogramSnapshot {
+    static constexpr size_t kBuckets = 65;
+
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+    // Bucket 0 counts zeros, bucket i > 0 values in [2^(i-1), 2^i)
+    std::array<uint64_t, kBuckets> buckets = {};
+
+    /// Exclusive upper bound of bucket i (saturates for the last one)
+    static uint64_t UpperBound(size_t i) {
+        return i == 0 ? 1 : i >= 64 ? UINT64_MAX : uint64_t{1} << i;
+    }
+
+    /**
+     * @brief Approximate quantile
+     * @param q Quantile in [0, 1]
+     * @return Upper bound of the bucket holding the q-th value, capped at
+     *         max (0 if nothing was recorded)
+     */
+    uint64_t Quantile(double q) const;
+};
+
+/**
+ * @brief Lock-free histogram of non-negative values in power-of-two buckets
+ *
+ * Recording is a few relaxed atomic operations, so one histogram can be
+ * shared by every executor worker. Quantiles are accurate to a factor of
+ * two, enough to tell a 50 us request from a 5 ms GC pause.
+ */
+class Histogram {
+public:
+    void Record(uint64_t value);
+
+    HistogramSnapshot Snapshot() const;
+
+    void Reset();
+
+private:
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+    std::array<std::atomic<uint64_t>, HistogramSnapshot::kBuckets> buckets_{};
+};
+
+/**
+ * @brief What one request cost, as measured by a TelemetryScope
+ */
+struct RequestSample {
+    uint64_t wall_ns = 0;          // Time inside the scope
+    uint64_t allocated_bytes = 0;  // Julia allocations meanwhile
+    uint64_t gc_pause_ns = 0;      // Julia GC time meanwhile
+    uint64_t compile_ns = 0;       // Julia JIT compilation time meanwhile
+    uint64_t collections = 0;      // Julia collections completed meanwhile
+    bool overlapped = false;       // Another request's scope was open too
+};
+
+/**
+ * @brief Histograms of the requests of one discipline method
+ *
+ * Julia's allocation and compilation counters are process-wide, so an
+ * overlapped sample would be charged for its neighbours' work as well.
+ * allocated_bytes, compile_ns and calls_compiling therefore only cover
+ * requests that ran alone; calls_overlapped counts the others.
+ */
+struct MethodStats {
+    Histogram wall_ns;
+    Histogram allocated_bytes;  // Requests that ran alone
+    Histogram gc_pause_ns;
+    Histogram compile_ns;       // Requests that ran alone
+    std::atomic<uint64_t> collections{0};       // Total over all requests
+    std::atomic<uint64_t> calls_with_gc{0};     // Requests a GC landed in
+    std::atomic<uint64_t> calls_compiling{0};   // Requests that compiled code
+    std::atomic<uint64_t> calls_overlapped{0};  // Requests run alongside others
+
+    void Record(const RequestSample& sample);
+    void Reset();
+};
+
+/**
+ * @brief Copy of a method's statistics, for reporting
+ */
+struct MethodTelemetry {
+    std::string method;
+    HistogramSnapshot wall_ns;
+    HistogramSnapshot allocated_bytes;
+    HistogramSnapshot gc_pause_ns;
+    HistogramSnapshot compile_ns;
+    uint64_t collections = 0;
+    uint64_t calls_with_gc = 0;
+    uint64_t calls_compiling = 0;
+    uint64_t calls_overlapped = 0;
+};
+
+/**
+ * @brief Per-method request telemetry of the server
+ *
+ * Each request into Julia (compute, compute_partials, solve_residuals, ...)
+ * is wrapped in a TelemetryScope that records its wall time and the Julia
+ * allocation, GC pause and compilation time that accrued meanwhile into
+ * the histograms of its method. Snapshot() returns them at any time; the
+ * TelemetryService RPC (proto/telemetry.proto) serves them to clients.
+ *
+ * The Julia counters are process-wide, so with several executor workers a
+ * request that overlapped another is flagged rather than charged for what
+ * its neighbours allocated or compiled (see MethodStats). GC pauses stop
+ * every thread, so those are charged to every request correctly.
+ */
+class RequestTelemetry {
+public:
+    static RequestTelemetry& GetInstance();
+
+    /**
+     * @brief Statistics of a method, created on first use
+     * Takes a lock, so per-request call sites look it up once and keep the
+     * reference (see TelemetryScope).
+     * @return Reference valid for the lifetime of the process
+     */
+    MethodStats& Method(std::string_view name);
+
+    /// Statistics of every method seen so far, by name
+    std::vector<MethodTelemetry> Snapshot() const;
+
+    /// Clear every method's statistics
+    void Reset();
+
+private:
+    RequestTelemetry() = default;
+
+    mutable std::mutex mutex_;
+    std::map<std::string, std::unique_ptr<MethodStats>, std::less<>> methods_;
+};
+
+/**
+ * @brief Records the request it spans into RequestTelemetry
+ *
+ * Construct on a Julia thread at the start of a request's Julia work,
+ * with the method's statistics looked up once per call site:
+ *
+ * @code
+ * static MethodStats& stats = RequestTelemetry::GetInstance().Method("compute");
+ * TelemetryScope telemetry(stats);
+ * @endcode
+ *
+ * Scopes nested on the same thread (compute_batch falling back to
+ * compute, say) are folded into the outermost one.
+ */
+class TelemetryScope {
+public:
+    explicit TelemetryScope(MethodStats& stats);
+
+    /// Looks the method up on every call; for tests and one-off scopes
+    explicit TelemetryScope(const char* method);
+
+    ~TelemetryScope();
+
+    TelemetryScope(const TelemetryScope&) = delete;
+    TelemetryScope& operator=(const TelemetryScope&) = delete;
+
+private:
+    void Begin(MethodStats& stats);
+
+    MethodStats* stats_ = nullptr;  // Null for a nested scope
+    RequestSample start_;           // Counter values at construction
+    uint64_t generation_ = 0;       // Scopes started up to this one (mod 2^32)
+};
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_TELEMETRY_H
@@ -0,0 +1,42 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#ifndef PHILOTE_JULIA_SERVER_JULIA_TELEMETRY_SERVICE_H
+#define PHILOTE_JULIA_SERVER_JULIA_TELEMETRY_SERVICE_H
+
+#include <vector>
+
+#include "julia_telemetry.h"
+#include "telemetry.grpc.pb.h"
+
+namespace philote {
+namespace julia {
+
+/**
+ * @brief Serves the server's per-method request telemetry
+ *
+ * Reports the histograms RequestTelemetry collects (see
+ * proto/telemetry.proto), so a client can tell whether tail latency comes
+ * from the discipline, from Julia's garbage collector or from JIT
+ * compilation while the server runs.
+ */
+class JuliaTelemetryService final : public RequestTelemetryService::Service {
+public:
+    grpc::Status GetRequestTelemetry(grpc::ServerContext* context,
+                                     const RequestTelemetryRequest* request,
+                                     RequestTelemetryResponse* response) override;
+};
+
+/**
+ * @brief Convert telemetry snapshots to their protobuf form
+ *
+ * @param methods Snapshot of each method, as from RequestTelemetry::Snapshot()
+ * @param response Receives one entry per method
+ */
+void DescribeRequestTelemetry(const std::vector<MethodTelemetry>& methods,
+                              RequestTelemetryResponse* response);
+
+}  // namespace julia
+}  // namespace philote
+
+#endif  // PHILOTE_JULIA_SERVER_JULIA_TELEMETRY_SERVICE_H
@@ -0,0 +1,381 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_async_server.h"
+
+#include <grpc/support/time.h>
+#include <grpcpp/alarm.h>
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace philote {
+namespace julia {
+
+namespace {
+
+constexpr size_t kChunkSize = 1000;  // Doubles per response message
+
+/**
+ * Bidirectional-streaming compute call: read input chunks until the client
+ * half-closes, run the discipline on the executor, stream the results.
+ * Result is philote::Variables for ComputeFunction and philote::Partials
+ * for ComputeGradient.
+ *
+ * Exactly one operation is outstanding at any time, so the call itself is
+ * the tag for every event.
+ */
+template<typename Result>
+class ComputeCall final : public JuliaAsyncServer::Call {
+public:
+    static constexpr bool kGradient = std::is_same_v<Result, philote::Partials>;
+
+    /**
+     * Queue a call object that waits for the next incoming RPC on cq
+     */
+    static void Listen(JuliaAsyncServer* server,
+                       grpc::ServerCompletionQueue* cq) {
+        auto* call = new ComputeCall(server, cq);
+        call->Issue([call]() { call->Request(); });
+    }
+
+    void Proceed(bool ok) override {
+        switch (state_) {
+            case State::kRequest:
+                OnRequest(ok);
+                break;
+            case State::kRead:
+                OnRead(ok);
+                break;
+            case State::kCompute:
+                OnComputed();
+                break;
+            case State::kWrite:
+                OnWrite(ok);
+                break;
+            case State::kFinish:
+                delete this;
+                break;
+        }
+    }
+
+private:
+    enum class State { kRequest, kRead, kCompute, kWrite, kFinish };
+
+    ComputeCall(JuliaAsyncServer* server, grpc::ServerCompletionQueue* cq)
+        : server_(server), cq_(cq), stream_(&context_) {}
+
+    // Start a queue operation, or give up on the call if shutting down.
+    // Must be the last thing a handler does.
+    template<typename Op>
+    void Issue(Op&& op) {
+        if (!server_->Post(std::forward<Op>(op))) {
+            delete this;
+        }
+    }
+
+    void Request() {
+        if constexpr (kGradient) {
+            server_->service().RequestComputeGradient(&context_, &stream_,
+                                                      cq_, cq_, this);
+        } else {
+            server_->service().RequestComputeFunction(&context_, &stream_,
+                                                      cq_, cq_, this);
+        }
+    }
+
+    void OnRequest(bool ok) {
+        if (!ok) {
+            delete this;  // Server is shutting down
+            return;
+        }
+
+        // Keep one call listening per queue
+        Listen(server_, cq_);
+
+        try {
+            inputs_ = server_->discipline().AllocateInputs();
+        } catch (const std::exception& e) {
+            Finish(grpc::Status(grpc::StatusCode::INTERNAL, e.what()));
+            return;
+        }
+        for (const auto& [name, var] : inputs_) {
+            expected_ += var.Size();
+            received_by_input_[name].assign(var.Size(), false);
+        }
+        Read();
+    }
+
+    void Read() {
+        state_ = State::kRead;
+        Issue([this]() { stream_.Read(&request_, this); });
+    }
+
+    void OnRead(bool ok) {
+        if (!ok) {
+            // The stream ends on a half-close and on cancellation alike;
+            // only a complete set of inputs is worth computing on
+            if (received_ < expected_) {
+                Finish(grpc::Status(
+                    grpc::StatusCode::CANCELLED,
+                    "Input stream ended before all inputs were received"));
+                return;
+            }
+            Compute();  // Client has sent all inputs
+            return;
+        }
+
+        grpc::Status status = AssignChunk();
+        if (!status.ok()) {
+            Finish(status);
+            return;
+        }
+        Read();
+    }
+
+    grpc::Status AssignChunk() {
+        const std::string& name = request_.name();
+        auto it = inputs_.find(name);
+        if (it == inputs_.end()) {
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                "Unknown input variable: " + name);
+        }
+
+        philote::Variable& var = it->second;
+        size_t count = static_cast<size_t>(request_.data_size());
+        if (request_.start() < 0 ||
+            static_cast<size_t>(request_.start()) + count > var.Size()) {
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                "Chunk out of range for input: " + name);
+        }
+
+        // A resent element overwrites the earlier value but counts once, so
+        // a duplicate chunk cannot stand in for one that was never sent
+        size_t start = static_cast<size_t>(request_.start());
+        std::vector<bool>& seen = received_by_input_[name];
+        for (size_t i = 0; i < count; ++i) {
+            var(start + i) = request_.data(static_cast<int>(i));
+            if (!seen[start + i]) {
+                seen[start + i] = true;
+                ++received_;
+            }
+        }
+        return grpc::Status::OK;
+    }
+
+    void Compute() {
+        state_ = State::kCompute;
+        server_->BeginCompute();
+        try {
+            if constexpr (kGradient) {
+                handle_ = server_->discipline().ComputePartialsAsync(inputs_);
+            } else {
+                handle_ = server_->discipline().ComputeAsync(inputs_);
+            }
+        } catch (const std::exception& e) {
+            server_->EndCompute();
+            Finish(grpc::Status(grpc::StatusCode::INTERNAL, e.what()));
+            return;
+        }
+
+        // Runs on the executor worker: hand the call back to its queue
+        // rather than doing gRPC work on a Julia thread
+        handle_.OnComplete([this]() {
+            JuliaAsyncServer* server = server_;
+            Issue([this]() {
+                alarm_.Set(cq_, gpr_now(GPR_CLOCK_MONOTONIC), this);
+            });
+            server->EndCompute();
+        });
+    }
+
+    void OnComputed() {
+        try {
+            Result result = handle_.Get();
+            if constexpr (kGradient) {
+                for (const auto& [key, value] : result) {
+                    AppendChunks(key.first, key.second, value);
+                }
+            } else {
+                for (const auto& [name, value] : result) {
+                    AppendChunks(name, "", value);
+                }
+            }
+        } catch (const std::exception& e) {
+            Finish(grpc::Status(grpc::StatusCode::INTERNAL, e.what()));
+            return;
+        }
+        WriteNext();
+    }
+
+    void AppendChunks(const std::string& name, const std::string& subname,
+                      const philote::Variable& var) {
+        size_t size = var.Size();
+        for (size_t start = 0; start < size; start += kChunkSize) {
+            size_t end = std::min(start + kChunkSize, size);
+
+            philote::Array& array = responses_.emplace_back();
+            array.set_name(name);
+            array.set_subname(subname);
+            array.set_start(static_cast<int64_t>(start));
+            array.set_end(static_cast<int64_t>(end));
+            if constexpr (!kGradient) {
+                array.set_type(philote::kOutput);
+            }
+            for (size_t i = start; i < end; ++i) {
+                array.add_data(var(i));
+            }
+        }
+    }
+
+    void WriteNext() {
+        if (next_ >= responses_.size()) {
+            Finish(grpc::Status::OK);
+            return;
+        }
+
+        const philote::Array& array = responses_[next_++];
+        if (next_ < responses_.size()) {
+            state_ = State::kWrite;
+            Issue([this, &array]() { stream_.Write(array, this); });
+        } else {
+            // Last message: write and finish in one operation
+            state_ = State::kFinish;
+            Issue([this, &array]() {
+                stream_.WriteAndFinish(array, grpc::WriteOptions(),
+                                       grpc::Status::OK, this);
+            });
+        }
+    }
+
+    void OnWrite(bool ok) {
+        if (!ok) {
+            Finish(grpc::Status(grpc::StatusCode::CANCELLED,
+                                "Client closed the stream"));
+            return;
+        }
+        WriteNext();
+    }
+
+    void Finish(const grpc::Status& status) {
+        state_ = State::kFinish;
+        Issue([this, &status]() { stream_.Finish(status, this); });
+    }
+
+    JuliaAsyncServer* server_;
+    grpc::ServerCompletionQueue* cq_;
+    grpc::ServerContext context_;
+    grpc::ServerAsyncReaderWriter<philote::Array, philote::Array> stream_;
+    State state_ = State::kRequest;
+
+    philote::Array request_;
+    philote::Variables inputs_;
+    size_t expected_ = 0;  // Input elements the discipline declares
+    size_t received_ = 0;  // Distinct input elements the client has sent
+    std::map<std::string, std::vector<bool>> received_by_input_;
+    TaskHandle<Result> handle_;
+    grpc::Alarm alarm_;
+
+    std::vector<philote::Array> responses_;
+    size_t next_ = 0;
+};
+
+}  // namespace
+
+JuliaAsyncServer::JuliaAsyncServer(
+    std::shared_ptr<JuliaExplicitDiscipline> discipline, int num_pollers)
+    : discipline_(std::move(discipline)), num_pollers_(num_pollers) {
+    if (num_pollers_ < 1) {
+        throw std::runtime_error(
+            "JuliaAsyncServer needs at least one polling thread");
+    }
+    discipline_service_.LinkPointers(discipline_.get());
+}
+
+JuliaAsyncServer::~JuliaAsyncServer() {
+    Shutdown();
+    discipline_service_.UnlinkPointers();
+}
+
+void JuliaAsyncServer::RegisterServices(grpc::ServerBuilder& builder) {
+    builder.RegisterService(&discipline_service_);
+    builder.RegisterService(&service_);
+    for (int i = 0; i < num_pollers_; ++i) {
+        queues_.push_back(builder.AddCompletionQueue());
+    }
+}
+
+void JuliaAsyncServer::Start() {
+    if (queues_.empty()) {
+        throw std::runtime_error(
+            "JuliaAsyncServer::RegisterServices() must be called before Start()");
+    }
+
+    for (auto& queue : queues_) {
+        grpc::ServerCompletionQueue* cq = queue.get();
+        ComputeCall<philote::Variables>::Listen(this, cq);
+        ComputeCall<philote::Partials>::Listen(this, cq);
+        pollers_.emplace_back(&JuliaAsyncServer::PollLoop, this, cq);
+    }
+    std::cout << "[ASYNC SERVER] Started " << pollers_.size()
+              << " completion-queue poller(s)" << std::endl;
+}
+
+void JuliaAsyncServer::Shutdown() {
+    {
+        std::unique_lock<std::shared_mutex> lock(shutdown_mutex_);
+        if (shutting_down_) {
+            return;
+        }
+        shutting_down_ = true;
+    }
+
+    // Called from the main (Julia) thread; waiting here must not block GC
+    // on executor workers that are finishing in-flight computes
+    GCSafeRegion gc_safe;
+
+    for (auto& queue : queues_) {
+        queue->Shutdown();
+    }
+    for (auto& poller : pollers_) {
+        if (poller.joinable()) {
+            poller.join();
+        }
+    }
+    pollers_.clear();
+
+    // Completion callbacks still reference this server
+    std::unique_lock<std::mutex> lock(compute_mutex_);
+    compute_done_.wait(lock, [this]() { return computes_in_flight_ == 0; });
+}
+
+void JuliaAsyncServer::BeginCompute() {
+    std::lock_guard<std::mutex> lock(compute_mutex_);
+    ++computes_in_flight_;
+}
+
+void JuliaAsyncServer::EndCompute() {
+    // Notify under the lock: Shutdown() may destroy this server as soon as
+    // it observes zero
+    std::lock_guard<std::mutex> lock(compute_mutex_);
+    if (--computes_in_flight_ == 0) {
+        compute_done_.notify_all();
+    }
+}
+
+void JuliaAsyncServer::PollLoop(grpc::ServerCompletionQueue* cq) {
+    void* tag;
+    bool ok;
+    while (cq->Next(&tag, &ok)) {
+        static_cast<Call*>(tag)->Proceed(ok);
+    }
+}
+
+}  // namespace julia
+}  // namespace philote
@@ -27,10 +27,41 @@ void DisciplineConfig::Validate() const {
         throw std::runtime_error("julia_type cannot be empty");
     }
 
+    if (batch_size < 1) {
+        throw std::runtime_error("batch_size must be >= 1");
+    }
+
+    if (batch_window_us < 0) {
+        throw std::runtime_error("batch_window_us must be >= 0");
+    }
+
+    if (max_multipoint_points < 1) {
+        throw std::runtime_error("max_multipoint_points must be >= 1");
+    }
+
+    if (!array_layout.empty() && array_layout != "row_major" &&
+        array_layout != "column_major") {
+        throw std::runtime_error(
+            "Invalid array_layout: '" + array_layout +
+            "'. Must be 'row_major' or 'column_major'");
+    }
+
+    for (const auto& [name, layout] : variable_layouts) {
+        if (layout != "row_major" && layout != "column_major") {
+            throw std::runtime_error(
+                "Invalid layout '" + layout + "' for variable '" + name +
+                "'. Must be 'row_major' or 'column_major'");
+        }
+    }
+
     // Check if file exists
     if (!std::filesystem::exists(julia_file)) {
         throw std::runtime_error("Julia file does not exist: " + julia_file);
     }
+
+    if (!sysimage.empty() && !std::filesystem::exists(sysimage)) {
+        throw std::runtime_error("Julia sysimage does not exist: " + sysimage);
+    }
 }
 
 void ServerConfig::Validate() const {
@@ -41,11 +72,66 @@ void ServerConfig::Validate() const {
     if (address.empty()) {
         throw std::runtime_error("server address cannot be empty");
     }
+
+    if (executor_mode != "serial" && executor_mode != "parallel") {
+        throw std::runtime_error(
+            "Invalid executor_mode: '" + executor_mode +
+            "'. Must be 'serial' or 'parallel'");
+    }
+
+    if (executor_workers < 1) {
+        throw std::runtime_error("executor_workers must be >= 1");
+    }
+
+    if (julia_threads < 1) {
+        throw std::runtime_error("julia_threads must be >= 1");
+    }
+
+    if (executor_mode == "serial" && executor_workers != 1) {
+        throw std::runtime_error(
+            "executor_workers > 1 requires executor_mode: parallel");
+    }
+
+    if (server_mode != "sync" && server_mode != "async") {
+        throw std::runtime_error(
+            "Invalid server_mode: '" + server_mode +
+            "'. Must be 'sync' or 'async'");
+    }
+
+    if (cq_threads < 1) {
+        throw std::runtime_error("cq_threads must be >= 1");
+    }
+
+    if (gc_idle_ms < 0) {
+        throw std::runtime_error("gc_idle_ms must be >= 0");
+    }
+
+    if (gc_full_threshold_mb < 0) {
+        throw std::runtime_error("gc_full_threshold_mb must be >= 0");
+    }
+
+    if (gc_defer_in_tasks && gc_full_threshold_mb == 0) {
+        throw std::runtime_error(
+            "gc_defer_in_tasks requires gc_full_threshold_mb > 0");
+    }
 }
 
 void PhiloteConfig::Validate() const {
     discipline.Validate();
     server.Validate();
+
+    if (server.server_mode == "async" && discipline.kind != "explicit") {
+        throw std::runtime_error(
+            "server_mode: async only supports explicit disciplines");
+    }
+
+    if (discipline.kind != "explicit" &&
+        (!discipline.array_layout.empty() ||
+         !discipline.variable_layouts.empty())) {
+        throw std::runtime_error(
+            "array_layout and variable_layouts only support explicit "
+            "disciplines");
+    }
 }
 
 PhiloteConfig PhiloteConfig::FromYaml(const std::string& yaml_path) {
@@ -103,6 +189,57 @@ PhiloteConfig PhiloteConfig::FromYaml(const std::string& yaml_path) {
     }
     result.discipline.julia_type = disc["julia_type"].as<std::string>();
 
+    // Parse sysimage (optional), relative to the YAML file like julia_file
+    if (disc["sysimage"]) {
+        std::filesystem::path sysimage_path(disc["sysimage"].as<std::string>());
+        if (sysimage_path.is_relative()) {
+            sysimage_path = yaml_dir / sysimage_path;
+        }
+        result.discipline.sysimage = sysimage_path.string();
+    }
+
+    // Parse batching (optional)
+    if (disc["batch_size"]) {
+        result.discipline.batch_size = disc["batch_size"].as<int>();
+    }
+
+    if (disc["batch_window_us"]) {
+        result.discipline.batch_window_us = disc["batch_window_us"].as<int>();
+    }
+
+    // Parse multi-point request limit (optional)
+    if (disc["max_multipoint_points"]) {
+        result.discipline.max_multipoint_points =
+            disc["max_multipoint_points"].as<int>();
+    }
+
+    // Parse zero_copy_inputs (optional)
+    if (disc["zero_copy_inputs"]) {
+        result.discipline.zero_copy_inputs = disc["zero_copy_inputs"].as<bool>();
+    }
+
+    // Parse reuse_input_dicts (optional)
+    if (disc["reuse_input_dicts"]) {
+        result.discipline.reuse_input_dicts =
+            disc["reuse_input_dicts"].as<bool>();
+    }
+
+    // Parse native_compute (optional)
+    if (disc["native_compute"]) {
+        result.discipline.native_compute = disc["native_compute"].as<bool>();
+    }
+
+    // Parse array_layout and variable_layouts (optional)
+    if (disc["array_layout"]) {
+        result.discipline.array_layout = disc["array_layout"].as<std::string>();
+    }
+    if (disc["variable_layouts"] && disc["variable_layouts"].IsMap()) {
+        for (const auto& entry : disc["variable_layouts"]) {
+            result.discipline.variable_layouts[entry.first.as<std::string>()] =
+                entry.second.as<std::string>();
+        }
+    }
+
     // Parse options (optional)
     if (disc["options"] && disc["options"].IsMap()) {
         for (const auto& opt : disc["options"]) {
@@ -139,6 +276,42 @@ PhiloteConfig PhiloteConfig::FromYaml(const std::string& yaml_path) {
         if (srv["max_threads"]) {
             result.server.max_threads = srv["max_threads"].as<int>();
         }
+
+        if (srv["executor_mode"]) {
+            result.server.executor_mode =
+                srv["executor_mode"].as<std::string>();
+        }
+
+        if (srv["executor_workers"]) {
+            result.server.executor_workers =
+                srv["executor_workers"].as<int>();
+        }
+
+        if (srv["julia_threads"]) {
+            result.server.julia_threads = srv["julia_threads"].as<int>();
+        }
+
+        if (srv["server_mode"]) {
+            result.server.server_mode = srv["server_mode"].as<std::string>();
+        }
+
+        if (srv["cq_threads"]) {
+            result.server.cq_threads = srv["cq_threads"].as<int>();
+        }
+
+        if (srv["gc_defer_in_tasks"]) {
+            result.server.gc_defer_in_tasks =
+                srv["gc_defer_in_tasks"].as<bool>();
+        }
+
+        if (srv["gc_idle_ms"]) {
+            result.server.gc_idle_ms = srv["gc_idle_ms"].as<int>();
+        }
+
+        if (srv["gc_full_threshold_mb"]) {
+            result.server.gc_full_threshold_mb =
+                srv["gc_full_threshold_mb"].as<int>();
+        }
     }
 
     // Validate configuration
@@ -158,6 +331,32 @@ void PhiloteConfig::ToYaml(const std::string& yaml_path) const {
     out << YAML::Key << "kind" << YAML::Value << discipline.kind;
     out << YAML::Key << "julia_file" << YAML::Value << discipline.julia_file;
     out << YAML::Key << "julia_type" << YAML::Value << discipline.julia_type;
+    if (!discipline.sysimage.empty()) {
+        out << YAML::Key << "sysimage" << YAML::Value << discipline.sysimage;
+    }
+    out << YAML::Key << "batch_size" << YAML::Value << discipline.batch_size;
+    out << YAML::Key << "batch_window_us" << YAML::Value
+        << discipline.batch_window_us;
+    out << YAML::Key << "max_multipoint_points" << YAML::Value
+        << discipline.max_multipoint_points;
+    out << YAML::Key << "zero_copy_inputs" << YAML::Value
+        << discipline.zero_copy_inputs;
+    out << YAML::Key << "reuse_input_dicts" << YAML::Value
+        << discipline.reuse_input_dicts;
+    out << YAML::Key << "native_compute" << YAML::Value
+        << discipline.native_compute;
+    if (!discipline.array_layout.empty()) {
+        out << YAML::Key << "array_layout" << YAML::Value
+            << discipline.array_layout;
+    }
+    if (!discipline.variable_layouts.empty()) {
+        out << YAML::Key << "variable_layouts";
+        out << YAML::Value << YAML::BeginMap;
+        for (const auto& [name, layout] : discipline.variable_layouts) {
+            out << YAML::Key << name << YAML::Value << layout;
+        }
+        out << YAML::EndMap;
+    }
 
     if (!discipline.options.empty()) {
         out << YAML::Key << "options";
@@ -181,6 +380,18 @@ void PhiloteConfig::ToYaml(const std::string& yaml_path) const {
     out << YAML::Value << YAML::BeginMap;
     out << YAML::Key << "address" << YAML::Value << server.address;
     out << YAML::Key << "max_threads" << YAML::Value << server.max_threads;
+    out << YAML::Key << "executor_mode" << YAML::Value
+        << server.executor_mode;
+    out << YAML::Key << "executor_workers" << YAML::Value
+        << server.executor_workers;
+    out << YAML::Key << "julia_threads" << YAML::Value << server.julia_threads;
+    out << YAML::Key << "server_mode" << YAML::Value << server.server_mode;
+    out << YAML::Key << "cq_threads" << YAML::Value << server.cq_threads;
+    out << YAML::Key << "gc_defer_in_tasks" << YAML::Value
+        << server.gc_defer_in_tasks;
+    out << YAML::Key << "gc_idle_ms" << YAML::Value << server.gc_idle_ms;
+    out << YAML::Key << "gc_full_threshold_mb" << YAML::Value
+        << server.gc_full_threshold_mb;
     out << YAML::EndMap;
 
     out << YAML::EndMap;
@@ -3,14 +3,237 @@
 
 #include "julia_convert.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <sstream>
+#include <utility>
 
 #include "julia_gc.h"
+#include "julia_runtime.h"
 
 namespace philote {
 namespace julia {
 
+namespace {
+
+// Copy a Variable into a Julia array's (column-major) data
+void CopyVariableToJulia(const philote::Variable& var, void* jl_data,
+                         const ArrayConverter& converter) {
+    if (var.Size() == 0) {
+        return;
+    }
+    converter.ToJulia(&const_cast<philote::Variable&>(var)(0), jl_data);
+}
+
+// Inverse of CopyVariableToJulia; var must already have its final shape
+void CopyJuliaToVariable(const void* jl_data, philote::Variable& var,
+                         const ArrayConverter& converter) {
+    if (var.Size() == 0) {
+        return;
+    }
+    converter.FromJulia(jl_data, &var(0));
+}
+
+// Element type of a Julia array holding variable data
+ElementType JuliaElementType(jl_value_t* array, const std::string& name) {
+    jl_value_t* eltype = jl_array_eltype(array);
+    if (eltype == reinterpret_cast<jl_value_t*>(jl_float64_type)) {
+        return ElementType::kFloat64;
+    }
+    if (eltype == reinterpret_cast<jl_value_t*>(jl_float32_type)) {
+        return ElementType::kFloat32;
+    }
+    throw std::runtime_error("Array for '" + name +
+                             "' must have Float64 or Float32 elements, got " +
+                             std::string(jl_typeof_str(array)));
+}
+
+// converter, or the same conversion for the element type Julia returned
+// (a Float64 result for a Float32 variable is widened just as well), built
+// in storage
+const ArrayConverter& ConverterFor(jl_value_t* array, const std::string& name,
+                                   const ArrayConverter& converter,
+                                   ArrayConverter& storage) {
+    ElementType type = JuliaElementType(array, name);
+    if (type == converter.element_type()) {
+        return converter;
+    }
+    storage = converter.WithElementType(type);
+    return storage;
+}
+
+// The converter built at setup for data of the variable's declared shape
+// and element type, or a new one in storage
+const ArrayConverter& LookupConverter(const VariableConverterMap* converters,
+                                      const std::string& name,
+                                      const std::vector<size_t>& shape,
+                                      ArrayLayout layout, ElementType type,
+                                      ArrayConverter& storage) {
+    if (converters) {
+        auto it = converters->find(name);
+        if (it != converters->end() && it->second.shape == shape &&
+            it->second.converter.element_type() == type) {
+            return it->second.converter;
+        }
+    }
+    storage = ArrayConverter(shape, layout, type);
+    return storage;
+}
+
+// Copy the stored values of a sparse block, widening Float32
+void AssignSparseValues(jl_value_t* array, const std::string& name,
+                        size_t nnz, std::vector<double>& values) {
+    values.resize(nnz);
+    const void* data = jl_array_data(array, void);
+    if (JuliaElementType(array, name) == ElementType::kFloat32) {
+        CopyElements(static_cast<const float*>(data), values.data(), nnz);
+    } else {
+        CopyElements(static_cast<const double*>(data), values.data(), nnz);
+    }
+}
+
+// Uninitialized Array{T, N} with the variable's dims, allocated with its
+// final shape (a shapeless variable is a vector)
+jl_array_t* AllocJuliaArray(const std::vector<size_t>& shape, size_t size,
+                            ElementType type) {
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+    switch (shape.size()) {
+        case 0:
+        case 1:
+            return jl_alloc_array_1d(handles.ArrayType(type, 1), size);
+        case 2:
+            return jl_alloc_array_2d(handles.ArrayType(type, 2), shape[0],
+                                     shape[1]);
+        case 3:
+            return jl_alloc_array_3d(handles.ArrayType(type, 3), shape[0],
+                                     shape[1], shape[2]);
+        default:
+            return jl_alloc_array_nd(handles.ArrayType(type, shape.size()),
+                                     const_cast<size_t*>(shape.data()),
+                                     shape.size());
+    }
+}
+
+// Array{Float64, N} with the variable's dims around data; Julia does not
+// own or free it
+jl_array_t* WrapJuliaArray(double* data, const std::vector<size_t>& shape,
+                           size_t size) {
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+    if (shape.size() <= 1) {
+        return jl_ptr_to_array_1d(handles.vector_float64_type, data, size, 0);
+    }
+
+    // NTuple{N, Int} of the dims, filled in place rather than boxed
+    GCFrame<1> frame;
+    jl_value_t* dims = frame.Set(0, jl_new_struct_uninit(jl_tupletype_fill(
+        shape.size(), reinterpret_cast<jl_value_t*>(jl_long_type))));
+    size_t* dims_data = reinterpret_cast<size_t*>(jl_data_ptr(dims));
+    for (size_t k = 0; k < shape.size(); ++k) {
+        dims_data[k] = shape[k];
+    }
+    return jl_ptr_to_array(handles.ArrayType(ElementType::kFloat64, shape.size()),
+                           data, dims, 0);
+}
+
+// Whether array has the dims AllocJuliaArray gives a variable of this shape
+bool HasVariableDims(jl_array_t* array, const std::vector<size_t>& shape,
+                     size_t size) {
+    if (shape.size() <= 1) {
+        return jl_array_ndims(array) == 1 && jl_array_len(array) == size;
+    }
+    if (jl_array_ndims(array) != shape.size()) {
+        return false;
+    }
+    for (size_t d = 0; d < shape.size(); ++d) {
+        if (jl_array_dim(array, d) != shape[d]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Shared by VariablesToJuliaDict and WrapVariablesAsJuliaDict
+jl_value_t* BuildVariablesDict(const philote::Variables& vars, bool borrow,
+                               const ArrayLayoutMap& layouts,
+                               const VariableConverterMap* converters) {
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+
+    // Dict{String, Vector{T}} unless some variable needs N-D storage, and
+    // Dict{String, Array} if the element types are mixed
+    bool all_vectors = true;
+    bool any_float64 = false;
+    bool any_float32 = false;
+    for (const auto& [name, var] : vars) {
+        all_vectors = all_vectors && var.Shape().size() == 1;
+        bool float32 = layouts.GetElementType(name) == ElementType::kFloat32;
+        any_float32 = any_float32 || float32;
+        any_float64 = any_float64 || !float32;
+    }
+    jl_value_t* dict_type;
+    if (any_float32 && any_float64) {
+        dict_type = handles.dict_string_any_array_type;
+    } else if (any_float32) {
+        dict_type = all_vectors ? handles.dict_string_vector32_type
+                                : handles.dict_string_array32_type;
+    } else {
+        dict_type = all_vectors ? handles.dict_string_vector_type
+                                : handles.dict_string_array_type;
+    }
+    // One frame roots the dict and each variable's array and key in turn
+    GCFrame<3> frame;
+    jl_value_t* dict = frame.Set(
+        0, jl_call0(reinterpret_cast<jl_function_t*>(dict_type)));
+    CheckJuliaException();
+
+    // Convert each variable into an array created with its final dims
+    ArrayConverter storage;
+    for (const auto& [name, var] : vars) {
+        const auto& shape = var.Shape();
+        size_t total_size = var.Size();
+        const ArrayConverter& converter =
+            LookupConverter(converters, name, shape, layouts.Get(name),
+                            layouts.GetElementType(name), storage);
+
+        jl_array_t* jl_array;
+        if (borrow && total_size > 0 && converter.julia_order()) {
+            // Wrap the Variable's buffer, which already has Julia's order
+            double* data = &const_cast<philote::Variable&>(var)(0);
+            jl_array = WrapJuliaArray(data, shape, total_size);
+        } else {
+            jl_array = AllocJuliaArray(shape, total_size,
+                                       converter.element_type());
+            CopyVariableToJulia(var, jl_array_data(jl_array, void), converter);
+        }
+        frame.Set(1, jl_array);
+
+        // Add to dictionary: dict[name] = array
+        jl_value_t* key = frame.Set(2, jl_cstr_to_string(name.c_str()));
+
+        jl_call3(handles.setindex_fn, dict,
+                 reinterpret_cast<jl_value_t*>(jl_array), key);
+        CheckJuliaException();
+    }
+
+    return dict;
+}
+
+}  // namespace
+
+VariableConverterMap MakeVariableConverters(
+    const std::vector<philote::VariableMetaData>& vars,
+    const ArrayLayoutMap& layouts) {
+    VariableConverterMap converters;
+    for (const auto& meta : vars) {
+        VariableConverter& entry = converters[meta.name()];
+        for (int64_t dim : meta.shape()) {
+            entry.shape.push_back(static_cast<size_t>(dim));
+        }
+        entry.converter = ArrayConverter(entry.shape, layouts.Get(meta.name()),
+                                         layouts.GetElementType(meta.name()));
+    }
+    return converters;
+}
+
 void CheckJuliaException() {
     if (jl_exception_occurred()) {
         std::string msg = GetJuliaExceptionString();
@@ -33,8 +256,9 @@ std::string GetJuliaExceptionString() {
 
     // Try to get detailed error message using Julia's display system
     // We need to be careful not to trigger another exception
-    jl_function_t* sprint_fn = jl_get_function(jl_base_module, "sprint");
-    jl_function_t* showerror_fn = jl_get_function(jl_base_module, "showerror");
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+    jl_function_t* sprint_fn = handles.sprint_fn;
+    jl_function_t* showerror_fn = handles.showerror_fn;
 
     if (sprint_fn && showerror_fn) {
         std::cerr << "[DEBUG] Calling sprint(showerror, ex)..." << std::endl;
@@ -70,108 +294,137 @@ std::string GetJuliaExceptionString() {
     return msg;
 }
 
-jl_value_t* VariablesToJuliaDict(const philote::Variables& vars) {
-    // Get Dict constructor
-    // Create empty Dict{String, Vector{Float64}} with proper type parameters
-    // First get the Dict type constructor
-    jl_value_t* dict_type = jl_get_global(jl_base_module, jl_symbol("Dict"));
-    if (!dict_type) {
-        throw std::runtime_error("Could not find Base.Dict type");
-    }
+jl_value_t* VariablesToJuliaDict(const philote::Variables& vars,
+                                 const ArrayLayoutMap& layouts,
+                                 const VariableConverterMap* converters) {
+    return BuildVariablesDict(vars, false, layouts, converters);
+}
 
-    // Create the parameterized type Dict{String, Vector{Float64}}
-    jl_value_t* string_type = reinterpret_cast<jl_value_t*>(jl_string_type);
-    jl_value_t* vector_float64_type = jl_apply_array_type(
-        reinterpret_cast<jl_value_t*>(jl_float64_type), 1);
+jl_value_t* WrapVariablesAsJuliaDict(const philote::Variables& vars,
+                                     const ArrayLayoutMap& layouts,
+                                     const VariableConverterMap* converters) {
+    return BuildVariablesDict(vars, true, layouts, converters);
+}
 
-    jl_value_t* dict_params[2] = {string_type, vector_float64_type};
-    jl_value_t* dict_parameterized = jl_apply_type(dict_type, dict_params, 2);
-    CheckJuliaException();
+jl_value_t* JuliaReusableDict::Reset(const philote::Variables& vars,
+                                     bool borrow,
+                                     const ArrayLayoutMap& layouts) {
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
 
-    // Create empty instance of Dict{String, Vector{Float64}}
-    jl_value_t* dict = jl_call0(reinterpret_cast<jl_function_t*>(dict_parameterized));
-    CheckJuliaException();
+    dict_ = nullptr;
+    entries_.clear();
+
+    GCFrame<3> frame;
+    jl_value_t* dict =
+        frame.Set(0, BuildVariablesDict(vars, false, layouts, nullptr));
 
+    std::map<std::string, Entry> entries;
+    for (const auto& [name, var] : vars) {
+        // Store our own key object so Update() can rebind entries with it
+        jl_value_t* key = frame.Set(1, jl_cstr_to_string(name.c_str()));
+        jl_value_t* array = frame.Set(2, jl_call2(handles.getindex_fn, dict, key));
+        CheckJuliaException();
+        jl_call3(handles.setindex_fn, dict, array, key);
+        CheckJuliaException();
 
-    // Get setindex! function for adding to dict
-    jl_function_t* setindex_fn =
-        jl_get_function(jl_base_module, "setindex!");
-    if (!setindex_fn) {
-        throw std::runtime_error("Could not find Base.setindex! function");
+        ArrayConverter converter(var.Shape(), layouts.Get(name),
+                                 layouts.GetElementType(name));
+        bool borrowed = borrow && var.Shape().size() == 1 &&
+                        var.Size() >= kMinBorrowSize && converter.julia_order();
+        entries[name] = Entry{
+            key, borrowed ? nullptr : reinterpret_cast<jl_array_t*>(array),
+            var.Size(), var.Shape(), std::move(converter)};
     }
 
-    // Convert each variable
-    for (const auto& [name, var] : vars) {
-        // Create Julia array from Variable data
-        const auto& shape = var.Shape();
-        size_t total_size = var.Size();
+    dict_ = dict;
+    entries_ = std::move(entries);
+    return dict_;
+}
 
-        // Create Julia array type
-        jl_value_t* array_type = jl_apply_array_type(
-            reinterpret_cast<jl_value_t*>(jl_float64_type), shape.size());
+bool JuliaReusableDict::Matches(const philote::Variables& vars) const {
+    if (!dict_ || vars.size() != entries_.size()) {
+        return false;
+    }
+    for (const auto& [name, var] : vars) {
+        auto it = entries_.find(name);
+        if (it == entries_.end() || it->second.shape != var.Shape()) {
+            return false;
+        }
+    }
+    return true;
+}
 
-        // Create dimensions tuple
-        jl_svec_t* dims = jl_alloc_svec(shape.size());
+jl_value_t* JuliaReusableDict::Update(const philote::Variables& vars) {
+    if (!Matches(vars)) {
+        return nullptr;
+    }
 
-        for (size_t i = 0; i < shape.size(); ++i) {
-            jl_svecset(dims, i, jl_box_int64(shape[i]));
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+    GCFrame<1> frame;
+    for (const auto& [name, var] : vars) {
+        const Entry& entry = entries_.at(name);
+        if (entry.array) {
+            CopyVariableToJulia(var, jl_array_data(entry.array, void),
+                                entry.converter);
+            continue;
         }
 
-        // Create array
-        jl_array_t* jl_array = jl_alloc_array_1d(array_type, total_size);
+        // Rebinding an existing key does not grow the dict
+        double* data = &const_cast<philote::Variable&>(var)(0);
+        jl_value_t* wrapper = frame.Set(
+            0, reinterpret_cast<jl_value_t*>(jl_ptr_to_array_1d(
+                   handles.vector_float64_type, data, entry.size, 0)));
+        jl_call3(handles.setindex_fn, dict_, wrapper, entry.key);
+        CheckJuliaException();
+    }
+    return dict_;
+}
 
-        // Copy data (C++ row-major to Julia column-major)
-        double* jl_data = jl_array_data(jl_array, double);
+void JuliaReusableDict::Read(philote::Variables& vars) {
+    if (!Matches(vars)) {
+        throw std::runtime_error(
+            "Variables do not match the layout of the reusable dict");
+    }
 
-        // For 1D arrays, direct copy
-        if (shape.size() == 1) {
-            for (size_t i = 0; i < total_size; ++i) {
-                jl_data[i] = var(i);
-            }
-        } else if (shape.size() == 2) {
-            // For 2D: transpose from row-major to column-major
-            size_t rows = shape[0];
-            size_t cols = shape[1];
-            for (size_t i = 0; i < rows; ++i) {
-                for (size_t j = 0; j < cols; ++j) {
-                    jl_data[j * rows + i] = var(i * cols + j);
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+    for (auto& [name, var] : vars) {
+        Entry& entry = entries_.at(name);
+        jl_value_t* value = jl_call2(handles.getindex_fn, dict_, entry.key);
+        CheckJuliaException();
+
+        // The converter reads raw memory in the element type and dims the
+        // entry was built with, which a replaced array may not have
+        if (!value || !jl_is_array(value) ||
+            jl_array_eltype(value) !=
+                JuliaHandleCache::ElementJuliaType(
+                    entry.converter.element_type()) ||
+            !HasVariableDims(reinterpret_cast<jl_array_t*>(value), entry.shape,
+                             entry.size)) {
+            std::string expected = "length " + std::to_string(entry.size);
+            if (entry.shape.size() > 1) {
+                expected = "dims " + std::to_string(entry.shape[0]);
+                for (size_t d = 1; d < entry.shape.size(); ++d) {
+                    expected += "x" + std::to_string(entry.shape[d]);
                 }
             }
-        } else {
-            // For higher dimensions, use direct copy (assume compatible layout)
-            for (size_t i = 0; i < total_size; ++i) {
-                jl_data[i] = var(i);
-            }
+            throw std::runtime_error(
+                "Entry '" + name + "' is not a " +
+                ElementTypeName(entry.converter.element_type()) +
+                " array of " + expected + ", got " +
+                (value ? std::string(jl_typeof_str(value)) : "nothing"));
         }
 
-        // Reshape array if multi-dimensional
-        if (shape.size() > 1) {
-            jl_function_t* reshape_fn =
-                jl_get_function(jl_base_module, "reshape");
-            jl_value_t** reshape_args = new jl_value_t*[shape.size() + 1];
-            reshape_args[0] = reinterpret_cast<jl_value_t*>(jl_array);
-            for (size_t i = 0; i < shape.size(); ++i) {
-                reshape_args[i + 1] = jl_box_int64(shape[i]);
-            }
-
-            jl_array = reinterpret_cast<jl_array_t*>(
-                jl_call(reshape_fn, reshape_args, shape.size() + 1));
-            delete[] reshape_args;
-            CheckJuliaException();
+        jl_array_t* array = reinterpret_cast<jl_array_t*>(value);
+        CopyJuliaToVariable(jl_array_data(array, void), var, entry.converter);
+        if (entry.array) {
+            entry.array = array;
         }
-
-        // Add to dictionary: dict[name] = array
-        jl_value_t* key = jl_cstr_to_string(name.c_str());
-
-        jl_call3(setindex_fn, dict, reinterpret_cast<jl_value_t*>(jl_array),
-                 key);
-        CheckJuliaException();
     }
-
-    return dict;
 }
 
-philote::Variables JuliaDictToVariables(jl_value_t* dict) {
+philote::Variables JuliaDictToVariables(jl_value_t* dict,
+                                        const ArrayLayoutMap& layouts,
+                                        const VariableConverterMap* converters) {
     if (!dict) {
         throw std::runtime_error("Expected Julia Dict, got null");
     }
@@ -180,25 +433,24 @@ philote::Variables JuliaDictToVariables(jl_value_t* dict) {
     philote::Variables vars;
 
     // Get dict keys and values
-    jl_function_t* keys_fn = jl_get_function(jl_base_module, "keys");
-    jl_function_t* getindex_fn = jl_get_function(jl_base_module, "getindex");
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+    jl_function_t* keys_fn = handles.keys_fn;
+    jl_function_t* getindex_fn = handles.getindex_fn;
 
-    if (!keys_fn || !getindex_fn) {
-        throw std::runtime_error("Could not find Base.keys or getindex");
-    }
-
-    jl_value_t* keys = jl_call1(keys_fn, dict);
+    GCFrame<2> frame;
+    jl_value_t* keys = frame.Set(0, jl_call1(keys_fn, dict));
     CheckJuliaException();
 
     // Convert keys to array
-    jl_function_t* collect_fn = jl_get_function(jl_base_module, "collect");
+    jl_function_t* collect_fn = handles.collect_fn;
     jl_array_t* keys_array =
-        reinterpret_cast<jl_array_t*>(jl_call1(collect_fn, keys));
+        reinterpret_cast<jl_array_t*>(frame.Set(1, jl_call1(collect_fn, keys)));
     CheckJuliaException();
 
     size_t num_keys = jl_array_len(keys_array);
 
     // Iterate through keys
+    ArrayConverter storage;
     for (size_t i = 0; i < num_keys; ++i) {
         jl_value_t* key = jl_array_ptr_ref(keys_array, i);
         if (!jl_is_string(key)) {
@@ -225,34 +477,15 @@ philote::Variables JuliaDictToVariables(jl_value_t* dict) {
             shape[d] = jl_array_dim(jl_array, d);
         }
 
-        // Get array data
-        double* jl_data = reinterpret_cast<double*>(jl_array_data(jl_array, double));
-        size_t total_size = jl_array_len(jl_array);
-
         // Create Variable
         philote::Variable var(philote::kOutput, shape);
 
-        // Copy data (Julia column-major to C++ row-major)
-        if (ndims == 1) {
-            // Direct copy for 1D
-            for (size_t i = 0; i < total_size; ++i) {
-                var(i) = jl_data[i];
-            }
-        } else if (ndims == 2) {
-            // Transpose for 2D
-            size_t rows = shape[0];
-            size_t cols = shape[1];
-            for (size_t i = 0; i < rows; ++i) {
-                for (size_t j = 0; j < cols; ++j) {
-                    var(i * cols + j) = jl_data[j * rows + i];
-                }
-            }
-        } else {
-            // Direct copy for higher dimensions
-            for (size_t i = 0; i < total_size; ++i) {
-                var(i) = jl_data[i];
-            }
-        }
+        // Copy data (Julia column-major to the variable's layout), widening
+        // Float32
+        CopyJuliaToVariable(
+            jl_array_data(jl_array, void), var,
+            LookupConverter(converters, name, shape, layouts.Get(name),
+                            JuliaElementType(value, name), storage));
 
         vars[name] = var;
     }
@@ -260,7 +493,17 @@ philote::Variables JuliaDictToVariables(jl_value_t* dict) {
     return vars;
 }
 
-philote::Partials JuliaDictToPartials(jl_value_t* dict) {
+philote::Partials JuliaDictToPartials(jl_value_t* dict,
+                                      const ArrayLayoutMap& layouts) {
+    SparsePartials sparse;
+    return JuliaDictToSparsePartials(dict, SparsityPatterns(), sparse, layouts);
+}
+
+philote::Partials JuliaDictToSparsePartials(jl_value_t* dict,
+                                            const SparsityPatterns& patterns,
+                                            SparsePartials& sparse,
+                                            const ArrayLayoutMap& layouts,
+                                            const PartialsBlockTable* table) {
     std::cerr << "[DEBUG] JuliaDictToPartials: Starting..." << std::endl;
     std::cerr.flush();
     if (!dict) {
@@ -273,24 +516,36 @@ philote::Partials JuliaDictToPartials(jl_value_t* dict) {
     std::cerr.flush();
     // Expect flat dict format: Dict{String, Vector{Float64}}
     // Keys are encoded as "output~input"
-    // NOTE: Variable names cannot contain '~' (reserved as delimiter)
-    jl_function_t* keys_fn = jl_get_function(jl_base_module, "keys");
-    jl_function_t* getindex_fn = jl_get_function(jl_base_module, "getindex");
-    jl_function_t* collect_fn = jl_get_function(jl_base_module, "collect");
+    // NOTE: Variable names cannot contain '~' here (reserved as delimiter);
+    // block-indexed results (JuliaBlocksToPartials) have no such limit
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+    jl_function_t* keys_fn = handles.keys_fn;
+    jl_function_t* getindex_fn = handles.getindex_fn;
+    jl_function_t* collect_fn = handles.collect_fn;
 
     std::cerr << "[DEBUG] JuliaDictToPartials: Getting keys..." << std::endl;
     std::cerr.flush();
-    jl_value_t* keys = jl_call1(keys_fn, dict);
+    GCFrame<2> frame;
+    jl_value_t* keys = frame.Set(0, jl_call1(keys_fn, dict));
     CheckJuliaException();
 
     jl_array_t* keys_array =
-        reinterpret_cast<jl_array_t*>(jl_call1(collect_fn, keys));
+        reinterpret_cast<jl_array_t*>(frame.Set(1, jl_call1(collect_fn, keys)));
     CheckJuliaException();
 
     size_t num_keys = jl_array_len(keys_array);
     std::cerr << "[DEBUG] JuliaDictToPartials: Found " << num_keys << " partial(s)" << std::endl;
     std::cerr.flush();
 
+    // Blocks are sorted by key
+    auto key_less = [](const PartialsBlock& block,
+                       const std::pair<const std::string*,
+                                       const std::string*>& key) {
+        int order = block.key.first.compare(*key.first);
+        return order < 0 || (order == 0 && block.key.second < *key.second);
+    };
+
+    ArrayConverter storage;
     for (size_t i = 0; i < num_keys; ++i) {
         jl_value_t* key = jl_array_ptr_ref(keys_array, i);
         if (!jl_is_string(key)) {
@@ -324,6 +579,23 @@ philote::Partials JuliaDictToPartials(jl_value_t* dict) {
 
         jl_array_t* jl_array = reinterpret_cast<jl_array_t*>(value);
 
+        // Declared sparse: the array holds only the stored entries
+        auto pattern = patterns.find({output_name, input_name});
+        if (pattern != patterns.end()) {
+            size_t nnz = pattern->second->nnz();
+            if (jl_array_len(jl_array) != nnz) {
+                throw std::runtime_error(
+                    "Sparse partial '" + encoded_key + "' has " +
+                    std::to_string(jl_array_len(jl_array)) +
+                    " value(s), its sparsity pattern has " +
+                    std::to_string(nnz));
+            }
+            SparsePartial& block = sparse[{output_name, input_name}];
+            block.pattern = pattern->second;
+            AssignSparseValues(value, encoded_key, nnz, block.values);
+            continue;
+        }
+
         // Convert array to Variable
         size_t ndims = jl_array_ndims(jl_array);
         std::vector<size_t> shape(ndims);
@@ -339,33 +611,34 @@ philote::Partials JuliaDictToPartials(jl_value_t* dict) {
         std::cerr << "]" << std::endl;
         std::cerr.flush();
 
-        double* jl_data = reinterpret_cast<double*>(jl_array_data(jl_array, double));
-        size_t total_size = jl_array_len(jl_array);
-
-        std::cerr << "[DEBUG] JuliaDictToPartials: total_size = " << total_size << std::endl;
+        std::cerr << "[DEBUG] JuliaDictToPartials: total_size = " << jl_array_len(jl_array) << std::endl;
         std::cerr.flush();
 
         philote::Variable var(philote::kOutput, shape);
         std::cerr << "[DEBUG] JuliaDictToPartials: Created Variable with Size() = " << var.Size() << std::endl;
         std::cerr.flush();
 
-        if (ndims == 1) {
-            for (size_t k = 0; k < total_size; ++k) {
-                var(k) = jl_data[k];
-            }
-        } else if (ndims == 2) {
-            size_t rows = shape[0];
-            size_t cols = shape[1];
-            for (size_t r = 0; r < rows; ++r) {
-                for (size_t c = 0; c < cols; ++c) {
-                    var(r * cols + c) = jl_data[c * rows + r];
-                }
-            }
-        } else {
-            for (size_t k = 0; k < total_size; ++k) {
-                var(k) = jl_data[k];
+        // The block's converter if the value has the declared shape
+        ElementType type = JuliaElementType(value, encoded_key);
+        const ArrayConverter* converter = nullptr;
+        if (table) {
+            auto block = std::lower_bound(table->begin(), table->end(),
+                                          std::make_pair(&output_name,
+                                                         &input_name),
+                                          key_less);
+            if (block != table->end() && block->key.first == output_name &&
+                block->key.second == input_name && !block->pattern &&
+                block->shape == shape &&
+                block->converter.element_type() == type) {
+                converter = &block->converter;
             }
         }
+        if (!converter) {
+            storage = ArrayConverter(
+                shape, layouts.GetPartial(output_name, input_name), type);
+            converter = &storage;
+        }
+        CopyJuliaToVariable(jl_array_data(jl_array, void), var, *converter);
 
         partials[{output_name, input_name}] = var;
     }
@@ -375,18 +648,202 @@ philote::Partials JuliaDictToPartials(jl_value_t* dict) {
     return partials;
 }
 
-jl_value_t* ProtobufStructToJuliaDict(const google::protobuf::Struct& s) {
-    // Get Dict constructor
-    jl_function_t* dict_fn = jl_get_function(jl_base_module, "Dict");
-    if (!dict_fn) {
-        throw std::runtime_error("Could not find Base.Dict");
+philote::Partials JuliaBlocksToPartials(jl_value_t* blocks,
+                                       const PartialsBlockTable& table,
+                                       SparsePartials& sparse) {
+    if (!blocks || !jl_is_array(blocks) ||
+        jl_stored_inline(jl_array_eltype(blocks))) {
+        throw std::runtime_error(
+            "Expected a Julia Vector of partials blocks");
+    }
+    jl_array_t* blocks_array = reinterpret_cast<jl_array_t*>(blocks);
+    if (jl_array_len(blocks_array) != table.size()) {
+        throw std::runtime_error(
+            "compute_partials() returned " +
+            std::to_string(jl_array_len(blocks_array)) +
+            " block(s), the partials index has " +
+            std::to_string(table.size()));
+    }
+
+    // The table is in key order, so every insert goes at the end
+    philote::Partials partials;
+    ArrayConverter storage;
+    for (size_t k = 0; k < table.size(); ++k) {
+        jl_value_t* value = jl_array_ptr_ref(blocks_array, k);
+        if (!value || value == jl_nothing) {
+            continue;  // Block not computed
+        }
+
+        const PartialsBlock& block = table[k];
+        size_t expected = block.pattern ? block.pattern->nnz() : block.size;
+        if (!jl_is_array(value) ||
+            jl_array_len(reinterpret_cast<jl_array_t*>(value)) != expected) {
+            throw std::runtime_error(
+                "Partials block " + std::to_string(k + 1) + " (d" +
+                block.key.first + "/d" + block.key.second +
+                ") must be an array of " + std::to_string(expected) +
+                " value(s)");
+        }
+        std::string name = "d" + block.key.first + "/d" + block.key.second;
+
+        if (block.pattern) {
+            SparsePartial& sparse_block =
+                sparse.emplace_hint(sparse.end(), block.key, SparsePartial())
+                    ->second;
+            sparse_block.pattern = block.pattern;
+            AssignSparseValues(value, name, expected, sparse_block.values);
+            continue;
+        }
+
+        philote::Variable var(philote::kOutput, block.shape);
+        CopyJuliaToVariable(jl_array_data(value, void), var,
+                            ConverterFor(value, name, block.converter, storage));
+        partials.emplace_hint(partials.end(), block.key, std::move(var));
+    }
+    return partials;
+}
+
+jl_value_t* StackedVariablesToJuliaDict(
+    const std::vector<const philote::Variables*>& points,
+    const ArrayLayoutMap& layouts,
+    const VariableConverterMap* converters) {
+    if (points.empty()) {
+        throw std::runtime_error("Cannot stack an empty set of input points");
+    }
+
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+
+    // Dict{String, Matrix{T}} in the declared element type, and
+    // Dict{String, Matrix} if the element types are mixed
+    bool any_float64 = false;
+    bool any_float32 = false;
+    for (const auto& [name, first] : *points[0]) {
+        bool float32 = layouts.GetElementType(name) == ElementType::kFloat32;
+        any_float32 = any_float32 || float32;
+        any_float64 = any_float64 || !float32;
+    }
+    jl_value_t* dict_type;
+    if (any_float32 && any_float64) {
+        dict_type = handles.dict_string_any_matrix_type;
+    } else if (any_float32) {
+        dict_type = handles.dict_string_matrix32_type;
+    } else {
+        dict_type = handles.dict_string_matrix_type;
     }
+    GCFrame<3> frame;
+    jl_value_t* dict = frame.Set(
+        0, jl_call0(reinterpret_cast<jl_function_t*>(dict_type)));
+    CheckJuliaException();
+
+    size_t num_points = points.size();
+    ArrayConverter storage;
+    for (const auto& [name, first] : *points[0]) {
+        size_t size = first.Size();
+        ElementType type = layouts.GetElementType(name);
+        const ArrayConverter& converter =
+            LookupConverter(converters, name, first.Shape(), layouts.Get(name),
+                            type, storage);
+
+        // Column j holds point j's variable in Julia element order
+        jl_array_t* matrix = frame.Set(
+            1, jl_alloc_array_2d(handles.ArrayType(type, 2), size, num_points));
+        char* jl_data = static_cast<char*>(jl_array_data(matrix, void));
+        size_t column_bytes = size * ElementSize(type);
+
+        for (size_t j = 0; j < num_points; ++j) {
+            auto it = points[j]->find(name);
+            if (it == points[j]->end() || it->second.Size() != size) {
+                throw std::runtime_error(
+                    "Input '" + name + "' is missing or has a different size "
+                    "in point " + std::to_string(j) + " of the batch");
+            }
+            CopyVariableToJulia(it->second, jl_data + j * column_bytes,
+                                converter);
+        }
 
-    jl_value_t* dict = jl_call0(dict_fn);
+        jl_value_t* key = frame.Set(2, jl_cstr_to_string(name.c_str()));
+        jl_call3(handles.setindex_fn, dict,
+                 reinterpret_cast<jl_value_t*>(matrix), key);
+        CheckJuliaException();
+    }
+
+    return dict;
+}
+
+std::vector<philote::Variables> JuliaDictToStackedVariables(
+    jl_value_t* dict,
+    const std::map<std::string, std::vector<size_t>>& shapes,
+    size_t num_points,
+    const ArrayLayoutMap& layouts,
+    const VariableConverterMap* converters) {
+    if (!dict) {
+        throw std::runtime_error("Expected Julia Dict, got null");
+    }
+
+    jl_function_t* getindex_fn =
+        JuliaRuntime::GetInstance().Handles().getindex_fn;
+
+    std::vector<philote::Variables> points(num_points);
+    ArrayConverter storage;
+    ArrayConverter typed_storage;
+    for (const auto& [name, shape] : shapes) {
+        jl_value_t* key = jl_cstr_to_string(name.c_str());
+        jl_value_t* value;
+        {
+            GCProtect key_protect(key);
+            value = jl_call2(getindex_fn, dict, key);
+            CheckJuliaException();
+        }
+
+        if (!value || !jl_is_array(value)) {
+            throw std::runtime_error("Batched output '" + name +
+                                     "' is not an array");
+        }
+        jl_array_t* jl_array = reinterpret_cast<jl_array_t*>(value);
+
+        // Float64 or Float32 only: the columns are read as raw memory
+        const ArrayConverter& converter = ConverterFor(
+            value, name,
+            LookupConverter(converters, name, shape, layouts.Get(name),
+                            layouts.GetElementType(name), storage),
+            typed_storage);
+
+        // One column per point, each holding the whole variable; a matching
+        // length alone would also pass a transposed or reshaped result
+        size_t size = 1;
+        for (size_t dim : shape) {
+            size *= dim;
+        }
+        if (jl_array_ndims(jl_array) != 2 ||
+            jl_array_dim(jl_array, 0) != size ||
+            jl_array_dim(jl_array, 1) != num_points) {
+            throw std::runtime_error(
+                "Batched output '" + name + "' must be a " +
+                std::to_string(size) + " x " + std::to_string(num_points) +
+                " matrix, got " + std::string(jl_typeof_str(value)) + " with " +
+                std::to_string(jl_array_len(jl_array)) + " element(s)");
+        }
+
+        // Column j is point j's variable; no Julia allocation from here on
+        const char* jl_data =
+            static_cast<const char*>(jl_array_data(jl_array, void));
+        size_t column_bytes = size * ElementSize(converter.element_type());
+        for (size_t j = 0; j < num_points; ++j) {
+            philote::Variable var(philote::kOutput, shape);
+            CopyJuliaToVariable(jl_data + j * column_bytes, var, converter);
+            points[j][name] = std::move(var);
+        }
+    }
+
+    return points;
+}
+
+jl_value_t* ProtobufStructToJuliaDict(const google::protobuf::Struct& s) {
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+    jl_value_t* dict = jl_call0(handles.dict_fn);
     CheckJuliaException();
 
-    jl_function_t* setindex_fn =
-        jl_get_function(jl_base_module, "setindex!");
+    jl_function_t* setindex_fn = handles.setindex_fn;
 
     // Iterate through struct fields
     for (const auto& [key, value] : s.fields()) {
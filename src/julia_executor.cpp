@@ -4,78 +4,403 @@
 #include "julia_executor.h"
 
 #include <julia.h>
+#include <julia_gcext.h>
+
 #include <iostream>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+// Exported by libjulia (Base.gc_live_bytes) but not declared in julia.h
+extern "C" int64_t jl_gc_live_bytes(void);
 
 namespace philote {
 namespace julia {
 
+namespace {
+
+constexpr size_t kQueueCapacity = 1024;  // Per-worker ring slots
+constexpr int kSpinIterations = 4096;    // Busy-poll before yielding
+constexpr int kYieldIterations = 64;     // Yield before parking
+
+thread_local int current_worker_index = -1;  // Set on executor workers
+
+// Where the calling thread is, for classifying collections it triggers
+enum class GCContext { kOutside, kTask, kIdle };
+thread_local GCContext gc_context = GCContext::kOutside;
+
+std::atomic<uint64_t> collections_during_tasks{0};
+std::atomic<uint64_t> collections_outside_tasks{0};
+std::atomic<uint64_t> idle_collections{0};
+std::atomic<uint64_t> idle_full_collections{0};
+
+// Runs on the thread that triggered the collection, before it starts
+void CountCollection(int /*full*/) {
+    if (gc_context == GCContext::kTask) {
+        collections_during_tasks.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        collections_outside_tasks.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+bool AboveThreshold(size_t threshold) {
+    return threshold > 0 &&
+           static_cast<size_t>(jl_gc_live_bytes()) > threshold;
+}
+
+inline void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+}  // namespace
+
 JuliaExecutor& JuliaExecutor::GetInstance() {
     static JuliaExecutor instance;
     return instance;
 }
 
-void JuliaExecutor::Start() {
-    executor_thread_ = std::thread(&JuliaExecutor::ExecutorLoop, this);
+void JuliaExecutor::Start(int num_workers) {
+    if (num_workers < 1) {
+        throw std::runtime_error("JuliaExecutor needs at least one worker");
+    }
+    if (!workers_.empty()) {
+        throw std::runtime_error("JuliaExecutor already started");
+    }
+
+    stopping_.store(false, std::memory_order_seq_cst);
+
+    static std::once_flag gc_callback_flag;
+    std::call_once(gc_callback_flag,
+                   []() { jl_gc_set_cb_pre_gc(&CountCollection, 1); });
+
+    for (int i = 0; i < num_workers; ++i) {
+        workers_.push_back(std::make_unique<Worker>(kQueueCapacity));
+    }
+    for (int i = 0; i < num_workers; ++i) {
+        Worker* worker = workers_[i].get();
+        worker->thread =
+            std::thread(&JuliaExecutor::ExecutorLoop, this, worker, i);
+    }
 }
 
 void JuliaExecutor::Stop() {
-    {
-        std::lock_guard<std::mutex> lock(queue_mutex_);
-        stop_ = true;
+    // Close the queues, then let submissions already past the check finish
+    // pushing. Workers empty their ring once they see the stop flag, so
+    // every task accepted up to here still runs.
+    stopping_.store(true, std::memory_order_seq_cst);
+    while (enqueuing_.load(std::memory_order_seq_cst) > 0) {
+        std::this_thread::yield();
+    }
+
+    for (auto& worker : workers_) {
+        worker->stop.store(true, std::memory_order_release);
+        worker->wake_epoch.fetch_add(1, std::memory_order_release);
+        worker->wake_epoch.notify_one();
+        { std::lock_guard<std::mutex> lock(worker->park_mutex); }
+        worker->park_cv.notify_one();
     }
-    cv_.notify_one();
 
-    if (executor_thread_.joinable()) {
-        executor_thread_.join();
+    // Stop may be called from a Julia thread; joining must not block GC
+    GCSafeRegion gc_safe;
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
     }
+    workers_.clear();
 }
 
 JuliaExecutor::~JuliaExecutor() {
     Stop();
 }
 
-void JuliaExecutor::ExecutorLoop() {
-    std::cout << "[EXECUTOR] Thread starting..." << std::endl;
+void JuliaExecutor::SetGCPolicy(const GCPolicy& policy) {
+    // The threshold is what turns collection back on under constant load
+    if (policy.defer_in_tasks && policy.full_threshold_bytes == 0) {
+        throw std::runtime_error(
+            "Deferring GC in tasks needs a full_threshold_bytes limit");
+    }
+    gc_defer_in_tasks_.store(policy.defer_in_tasks, std::memory_order_relaxed);
+    gc_idle_interval_ns_.store(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            policy.idle_interval)
+            .count(),
+        std::memory_order_relaxed);
+    gc_full_threshold_.store(policy.full_threshold_bytes,
+                             std::memory_order_relaxed);
+}
+
+GCPolicy JuliaExecutor::GetGCPolicy() const {
+    GCPolicy policy;
+    policy.defer_in_tasks = gc_defer_in_tasks_.load(std::memory_order_relaxed);
+    policy.idle_interval = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::nanoseconds(
+            gc_idle_interval_ns_.load(std::memory_order_relaxed)));
+    policy.full_threshold_bytes =
+        gc_full_threshold_.load(std::memory_order_relaxed);
+    return policy;
+}
+
+GCCounts JuliaExecutor::CollectionCounts() {
+    GCCounts counts;
+    counts.during_tasks =
+        collections_during_tasks.load(std::memory_order_relaxed);
+    counts.outside_tasks =
+        collections_outside_tasks.load(std::memory_order_relaxed);
+    counts.idle = idle_collections.load(std::memory_order_relaxed);
+    counts.idle_full = idle_full_collections.load(std::memory_order_relaxed);
+    return counts;
+}
+
+JuliaExecutor::Worker& JuliaExecutor::SelectWorker(TaskAffinity affinity) {
+    if (workers_.empty()) {
+        throw std::runtime_error("JuliaExecutor has not been started");
+    }
+    if (affinity == TaskAffinity::kSerial || workers_.size() == 1) {
+        return *workers_[0];
+    }
+
+    // Two-choice load balancing: of two neighbouring workers starting at a
+    // round-robin position, take the one with fewer pending tasks
+    size_t n = workers_.size();
+    size_t first = next_worker_.fetch_add(1, std::memory_order_relaxed) % n;
+    size_t second = (first + 1) % n;
+    Worker& a = *workers_[first];
+    Worker& b = *workers_[second];
+    return b.pending.load(std::memory_order_relaxed) <
+                   a.pending.load(std::memory_order_relaxed)
+               ? b
+               : a;
+}
+
+void JuliaExecutor::Enqueue(TaskAffinity affinity, Task task) {
+    // Pairs with Stop(): either Stop sees this call in progress and waits
+    // for the push, or this call sees the executor stopping
+    enqueuing_.fetch_add(1, std::memory_order_seq_cst);
+    struct Leave {
+        std::atomic<int>& count;
+        ~Leave() { count.fetch_sub(1, std::memory_order_seq_cst); }
+    } leave{enqueuing_};
+    if (stopping_.load(std::memory_order_seq_cst)) {
+        throw std::runtime_error("JuliaExecutor is stopping");
+    }
+
+    Worker& worker = SelectWorker(affinity);
+    worker.pending.fetch_add(1, std::memory_order_relaxed);
+
+    // A full ring applies back-pressure to the submitting thread
+    while (!worker.task_queue.TryPush(std::move(task))) {
+        std::this_thread::yield();
+    }
+    Wake(worker);
+}
+
+void JuliaExecutor::Wake(Worker& worker) {
+    // Pairs with the fence in WaitForTask: either the worker sees the new
+    // task before parking, or we see it parked and bump the epoch
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (worker.parked.load(std::memory_order_relaxed)) {
+        worker.wake_epoch.fetch_add(1, std::memory_order_release);
+        worker.wake_epoch.notify_one();
+
+        // The worker may be in a timed park instead; taking the mutex
+        // orders the epoch bump before its predicate check
+        { std::lock_guard<std::mutex> lock(worker.park_mutex); }
+        worker.park_cv.notify_one();
+    }
+}
+
+JuliaExecutor::WaitResult JuliaExecutor::WaitForTask(
+    Worker* worker, Task& task, Clock::time_point deadline) {
+    // Spin first: under load the next task usually arrives within
+    // microseconds, far sooner than a park/unpark round trip
+    for (int i = 0; i < kSpinIterations; ++i) {
+        if (worker->task_queue.TryPop(task)) {
+            return WaitResult::kTask;
+        }
+        if (worker->stop.load(std::memory_order_acquire)) {
+            return WaitResult::kStop;
+        }
+        CpuRelax();
+    }
+
+    for (int i = 0; i < kYieldIterations; ++i) {
+        if (worker->task_queue.TryPop(task)) {
+            return WaitResult::kTask;
+        }
+        if (worker->stop.load(std::memory_order_acquire)) {
+            return WaitResult::kStop;
+        }
+        std::this_thread::yield();
+    }
+
+    while (true) {
+        uint32_t epoch = worker->wake_epoch.load(std::memory_order_acquire);
+        worker->parked.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (worker->task_queue.TryPop(task)) {
+            worker->parked.store(false, std::memory_order_relaxed);
+            return WaitResult::kTask;
+        }
+        if (worker->stop.load(std::memory_order_acquire)) {
+            worker->parked.store(false, std::memory_order_relaxed);
+            return WaitResult::kStop;
+        }
+
+        if (deadline == Clock::time_point::max()) {
+            worker->wake_epoch.wait(epoch, std::memory_order_acquire);
+        } else {
+            // An idle collection is due at the deadline
+            std::unique_lock<std::mutex> lock(worker->park_mutex);
+            bool woken = worker->park_cv.wait_until(lock, deadline, [&]() {
+                return worker->wake_epoch.load(std::memory_order_acquire) !=
+                       epoch;
+            });
+            if (!woken) {
+                worker->parked.store(false, std::memory_order_relaxed);
+                return WaitResult::kIdle;
+            }
+        }
+        worker->parked.store(false, std::memory_order_relaxed);
+    }
+}
+
+int JuliaExecutor::CurrentWorkerIndex() {
+    return current_worker_index;
+}
+
+void JuliaExecutor::RunTask(Task& task) {
+    // Below the full-collection threshold, hold collections off until the
+    // task is done; Julia catches up on its next allocation or when idle
+    bool defer = gc_defer_in_tasks_.load(std::memory_order_relaxed) &&
+                 !AboveThreshold(
+                     gc_full_threshold_.load(std::memory_order_relaxed));
+
+    // jl_gc_enable() moves a process-wide counter, so it must be restored
+    // however the task ends
+    struct Restore {
+        bool defer;
+        int was_enabled;
+        ~Restore() {
+            gc_context = GCContext::kOutside;
+            if (defer) {
+                jl_gc_enable(was_enabled);
+            }
+        }
+    } restore{defer, defer ? jl_gc_enable(0) : 1};
+    gc_context = GCContext::kTask;
+
+    // An exception leaving the worker would terminate the process; tasks
+    // that can fail report through their completion slot instead
+    try {
+        task();  // Execute Julia call on this dedicated thread
+    } catch (const std::exception& e) {
+        std::cerr << "[EXECUTOR ERROR] Task failed: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "[EXECUTOR ERROR] Task failed" << std::endl;
+    }
+}
+
+JuliaExecutor::Clock::time_point JuliaExecutor::CollectIfIdle() {
+    int64_t interval = gc_idle_interval_ns_.load(std::memory_order_relaxed);
+    if (interval <= 0 || !gc_due_.load(std::memory_order_acquire)) {
+        return Clock::time_point::max();
+    }
+
+    // Idle means no worker has a task queued or has run one for the whole
+    // interval. A busy worker sets its own deadline when it is done.
+    for (const auto& worker : workers_) {
+        if (worker->pending.load(std::memory_order_relaxed) > 0) {
+            return Clock::time_point::max();
+        }
+    }
+    int64_t wait_ns = last_task_end_ns_.load(std::memory_order_relaxed) +
+                      interval - NowNs();
+    if (wait_ns > 0) {
+        return Clock::now() + std::chrono::nanoseconds(wait_ns);
+    }
+
+    // Several workers may time out together; one collects
+    if (!gc_due_.exchange(false, std::memory_order_acq_rel)) {
+        return Clock::time_point::max();
+    }
+    bool full =
+        AboveThreshold(gc_full_threshold_.load(std::memory_order_relaxed));
+    gc_context = GCContext::kIdle;
+    jl_gc_collect(full ? JL_GC_FULL : JL_GC_INCREMENTAL);
+    gc_context = GCContext::kOutside;
+    idle_collections.fetch_add(1, std::memory_order_relaxed);
+    if (full) {
+        idle_full_collections.fetch_add(1, std::memory_order_relaxed);
+    }
+    return Clock::time_point::max();
+}
+
+void JuliaExecutor::ExecutorLoop(Worker* worker, int index) {
+    std::cout << "[EXECUTOR] Worker " << index << " starting..." << std::endl;
+    current_worker_index = index;
 
     // CRITICAL: Adopt this thread for Julia
     // Julia runtime was initialized on main thread, but this thread needs adoption
     jl_adopt_thread();
-    std::cout << "[EXECUTOR] Thread adopted by Julia" << std::endl;
-    std::cout << "[EXECUTOR] Thread ID: " << std::this_thread::get_id() << std::endl;
+    std::cout << "[EXECUTOR] Worker " << index << " adopted by Julia (thread "
+              << std::this_thread::get_id() << ")" << std::endl;
 
-    // This thread handles ALL Julia calls - no concurrency!
+    // Tasks on one worker never overlap; concurrency only comes from
+    // kAnyWorker tasks spread across several workers
+    Clock::time_point idle_deadline = Clock::time_point::max();
     while (true) {
-        std::function<void()> task;
+        Task task;
 
+        WaitResult result;
         {
-            std::unique_lock<std::mutex> lock(queue_mutex_);
-            std::cout << "[EXECUTOR] Waiting for task..." << std::endl;
-            cv_.wait(lock, [this] { return stop_ || !task_queue_.empty(); });
-
-            if (stop_ && task_queue_.empty()) {
-                std::cout << "[EXECUTOR] Stopping..." << std::endl;
-                break;
-            }
+            // Idle workers must be GC-safe so a collection triggered on
+            // another worker does not wait for them
+            GCSafeRegion gc_safe;
+            result = WaitForTask(worker, task, idle_deadline);
+        }
 
-            if (!task_queue_.empty()) {
-                task = std::move(task_queue_.front());
-                task_queue_.pop();
-                std::cout << "[EXECUTOR] Got task from queue" << std::endl;
+        if (result == WaitResult::kStop) {
+            std::cout << "[EXECUTOR] Worker " << index << " stopping..."
+                      << std::endl;
+            // A task pushed between the last TryPop and the stop flag is
+            // still in the ring; its submitter is waiting on it
+            while (worker->task_queue.TryPop(task)) {
+                RunTask(task);
+                worker->pending.fetch_sub(1, std::memory_order_relaxed);
             }
+            break;
+        }
+        if (result == WaitResult::kIdle) {
+            idle_deadline = CollectIfIdle();
+            continue;
         }
 
-        if (task) {
-            std::cout << "[EXECUTOR] Executing task..." << std::endl;
-            try {
-                task();  // Execute Julia call on this dedicated thread
-                std::cout << "[EXECUTOR] Task completed successfully" << std::endl;
-            } catch (const std::exception& e) {
-                std::cerr << "[EXECUTOR ERROR] Task failed: " << e.what() << std::endl;
-                throw;
-            }
+        RunTask(task);
+        worker->pending.fetch_sub(1, std::memory_order_relaxed);
+
+        int64_t interval =
+            gc_idle_interval_ns_.load(std::memory_order_relaxed);
+        if (interval > 0) {
+            last_task_end_ns_.store(NowNs(), std::memory_order_relaxed);
+            gc_due_.store(true, std::memory_order_release);
+            idle_deadline = Clock::now() + std::chrono::nanoseconds(interval);
         }
     }
-    std::cout << "[EXECUTOR] Thread exiting" << std::endl;
+    std::cout << "[EXECUTOR] Worker " << index << " exiting" << std::endl;
 }
 
 }  // namespace julia
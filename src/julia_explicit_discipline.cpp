@@ -3,22 +3,94 @@
 
 #include "julia_explicit_discipline.h"
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <set>
 #include <stdexcept>
+#include <string>
+#include <tuple>
 
 #include "julia_convert.h"
 #include "julia_executor.h"
 #include "julia_gc.h"
 #include "julia_runtime.h"
+#include "julia_telemetry.h"
 #include "julia_thread.h"
 
 namespace philote {
 namespace julia {
 
+namespace {
+
+// Layout named by a Julia String or Symbol
+ArrayLayout JuliaToArrayLayout(jl_value_t* value) {
+    if (value && jl_is_string(value)) {
+        return ParseArrayLayout(jl_string_ptr(value));
+    }
+    if (value && jl_is_symbol(value)) {
+        return ParseArrayLayout(
+            jl_symbol_name(reinterpret_cast<jl_sym_t*>(value)));
+    }
+    throw std::runtime_error(
+        "array_layout() values must be a String or Symbol");
+}
+
+// Optional third element of an inputs/outputs metadata tuple
+ElementType JuliaToElementType(jl_value_t* value, const std::string& name) {
+    if (value == reinterpret_cast<jl_value_t*>(jl_float64_type)) {
+        return ElementType::kFloat64;
+    }
+    if (value == reinterpret_cast<jl_value_t*>(jl_float32_type)) {
+        return ElementType::kFloat32;
+    }
+    throw std::runtime_error("Element type of variable '" + name +
+                             "' must be Float64 or Float32");
+}
+
+// _philote_has_method: whether f has a method that can take this
+// discipline as its first argument
+constexpr const char* kDisciplineHelpersSource = R"julia(
+_philote_has_method(f, discipline) =
+    !isempty(methods(f, Tuple{typeof(discipline), Vararg{Any}}))
+)julia";
+
+// _philote_native_compute: (cfunction, pointer) for compute_packed! on one
+// discipline. The closure fixes the discipline's concrete type, so the
+// compiled body has no dynamic dispatch on it
+constexpr const char* kNativeComputeSource = R"julia(
+function _philote_native_compute(discipline)
+    # x and y are the caller's rooted buffers, passed as Julia objects
+    f = function (x, y, msg::Ptr{UInt8}, nmsg::Csize_t)
+        try
+            compute_packed!(discipline, x::Vector{Float64}, y::Vector{Float64})
+            return Cint(0)
+        catch err
+            text = sprint(showerror, err)
+            n = min(sizeof(text), Int(nmsg) - 1)
+            if n < sizeof(text)
+                n = thisind(text, n + 1) - 1  # Whole characters only
+            end
+            GC.@preserve text unsafe_copyto!(msg, pointer(text), n)
+            unsafe_store!(msg, 0x00, n + 1)
+            return Cint(1)
+        end
+    end
+    argtypes = (Any, Any, Ptr{UInt8}, Csize_t)
+    precompile(f, argtypes)
+    cf = @cfunction($f, Cint, (Any, Any, Ptr{UInt8}, Csize_t))
+    return (cf, Base.unsafe_convert(Ptr{Cvoid}, cf))
+end
+)julia";
+
+}  // namespace
+
 thread_local bool JuliaExplicitDiscipline::julia_adopted_ = false;
 
 JuliaExplicitDiscipline::JuliaExplicitDiscipline(
     const DisciplineConfig& config)
-    : config_(config), module_(nullptr), discipline_obj_(nullptr) {
+    : config_(config), module_(nullptr) {
     // Discipline construction happens on main thread
     // Julia initialization and loading will happen in Initialize()
     std::cout << "[DEBUG] JuliaExplicitDiscipline constructor" << std::endl;
@@ -71,14 +143,14 @@ void JuliaExplicitDiscipline::LoadJuliaDiscipline() {
         std::cerr << "[DEBUG] LoadJuliaDiscipline: Calling constructor (jl_call0)..." << std::endl;
         std::cerr.flush();
 
-        discipline_obj_ = jl_call0(reinterpret_cast<jl_function_t*>(type));
+        discipline_obj_.Set(jl_call0(reinterpret_cast<jl_function_t*>(type)));
 
         std::cerr << "[DEBUG] LoadJuliaDiscipline: Constructor called, checking for exception..." << std::endl;
         std::cerr.flush();
 
         CheckJuliaException();
 
-        std::cerr << "[DEBUG] LoadJuliaDiscipline: No exception, discipline_obj_ = " << discipline_obj_ << std::endl;
+        std::cerr << "[DEBUG] LoadJuliaDiscipline: No exception, discipline_obj_ = " << discipline_obj_.get() << std::endl;
         std::cerr.flush();
 
         if (!discipline_obj_) {
@@ -86,8 +158,64 @@ void JuliaExplicitDiscipline::LoadJuliaDiscipline() {
                                      config_.julia_type);
         }
 
-        // No need to store in globals - just keep as C++ member variable
-        // GC protection is handled by GCProtect when we use it
+        // Disciplines opt in to concurrent compute calls by defining
+        // is_thread_safe(discipline) = true
+        jl_function_t* thread_safe_fn = GetDisciplineMethod("is_thread_safe");
+        if (thread_safe_fn) {
+            jl_value_t* thread_safe = jl_call1(thread_safe_fn, discipline_obj_.get());
+            CheckJuliaException();
+            thread_safe_ = thread_safe && jl_is_bool(thread_safe) &&
+                           jl_unbox_bool(thread_safe);
+        }
+
+        // Batching needs both the config knob and a compute_batch method
+        has_compute_batch_ = GetDisciplineMethod("compute_batch") != nullptr;
+        if (config_.batch_size > 1) {
+            if (has_compute_batch_) {
+                batcher_ = std::make_unique<
+                    RequestBatcher<philote::Variables, philote::Variables>>(
+                    [this](const std::vector<const philote::Variables*>& points) {
+                        return RunComputeBatch(points);
+                    },
+                    static_cast<size_t>(config_.batch_size),
+                    std::chrono::microseconds(config_.batch_window_us),
+                    ComputeAffinity());
+            } else {
+                std::cerr << "[WARNING] batch_size is " << config_.batch_size
+                          << " but the discipline defines no compute_batch(); "
+                          << "batching disabled" << std::endl;
+            }
+        }
+
+        ResolveArrayLayouts();
+
+        // In-place compute!(discipline, inputs, outputs) is preferred
+        has_compute_inplace_ = GetDisciplineMethod("compute!") != nullptr;
+
+        // Packed ABI compute_packed!(discipline, inputs, outputs) over both
+        has_compute_packed_ = GetDisciplineMethod("compute_packed!") != nullptr;
+        if (has_compute_packed_) {
+            packed_roots_.resize(
+                2 * JuliaExecutor::GetInstance().NumWorkers());
+        }
+        if (has_compute_packed_ && config_.native_compute) {
+            CompileNativeCompute();
+        }
+
+        // Persistent dicts: one input and one output slot per worker, filled
+        // on first use
+        if (config_.reuse_input_dicts || has_compute_inplace_) {
+            size_t num_workers = JuliaExecutor::GetInstance().NumWorkers();
+            if (config_.reuse_input_dicts) {
+                input_dicts_.resize(num_workers);
+            }
+            if (has_compute_inplace_) {
+                output_dicts_.resize(num_workers);
+            }
+            dict_roots_.resize(2 * num_workers);
+        }
+
+        // Everything above is rooted through the runtime's root pool
         std::cerr << "[DEBUG] LoadJuliaDiscipline: Complete!" << std::endl;
         std::cerr.flush();
     });
@@ -144,6 +272,9 @@ void JuliaExplicitDiscipline::Setup() {
 
             // Extract I/O metadata and register with Philote-Cpp
             ExtractIOMetadata();
+            CheckArrayLayoutNames();
+            variable_converters_ =
+                MakeVariableConverters(var_meta(), array_layouts_);
             std::cout << "[DEBUG] ExtractIOMetadata completed" << std::endl;
 
             // Declare all partials: dy/dx for all outputs and inputs
@@ -164,6 +295,8 @@ void JuliaExplicitDiscipline::Setup() {
                 }
             }
             std::cout << "[DEBUG] Partials declared" << std::endl;
+
+            BuildPackedIndexes();
         });
         std::cout << "[DEBUG] Setup completed successfully" << std::endl;
     } catch (const std::exception& e) {
@@ -178,10 +311,11 @@ void JuliaExplicitDiscipline::ExtractIOMetadata() {
     // All temporary Julia objects here are short-lived and immediately processed
     std::cout << "[DEBUG] ExtractIOMetadata: Starting..." << std::endl;
     jl_value_t* discipline_obj = GetDisciplineObject();
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
 
     // Get inputs metadata
     std::cout << "[DEBUG] ExtractIOMetadata: Getting getproperty function..." << std::endl;
-    jl_function_t* getproperty_fn = jl_get_function(jl_base_module, "getproperty");
+    jl_function_t* getproperty_fn = handles.getproperty_fn;
     jl_value_t* inputs_sym = reinterpret_cast<jl_value_t*>(jl_symbol("inputs"));
     jl_value_t* outputs_sym = reinterpret_cast<jl_value_t*>(jl_symbol("outputs"));
 
@@ -196,9 +330,9 @@ void JuliaExplicitDiscipline::ExtractIOMetadata() {
 
         // Iterate through inputs and add to discipline
         std::cout << "[DEBUG] ExtractIOMetadata: Getting Julia functions..." << std::endl;
-        jl_function_t* keys_fn = jl_get_function(jl_base_module, "keys");
-        jl_function_t* collect_fn = jl_get_function(jl_base_module, "collect");
-        jl_function_t* getindex_fn = jl_get_function(jl_base_module, "getindex");
+        jl_function_t* keys_fn = handles.keys_fn;
+        jl_function_t* collect_fn = handles.collect_fn;
+        jl_function_t* getindex_fn = handles.getindex_fn;
 
         std::cout << "[DEBUG] ExtractIOMetadata: Getting keys..." << std::endl;
         jl_value_t* keys = jl_call1(keys_fn, inputs_dict);
@@ -226,13 +360,14 @@ void JuliaExplicitDiscipline::ExtractIOMetadata() {
             CheckJuliaException();
             std::cout << "[DEBUG] ExtractIOMetadata: Got metadata: " << meta << std::endl;
 
-            // Metadata is a tuple (shape_vector, units_string)
+            // Metadata is a tuple (shape_vector, units_string), optionally
+            // followed by the element type (Float64 or Float32)
             // Access tuple elements by index, not by property name
             std::cout << "[DEBUG] ExtractIOMetadata: Extracting shape and units from tuple..." << std::endl;
 
-            // meta should be a tuple with 2 elements: ([shape...], "units")
-            if (!jl_is_tuple(meta) || jl_nfields(meta) != 2) {
-                std::cerr << "[ERROR] Expected metadata to be a 2-element tuple" << std::endl;
+            // meta should be ([shape...], "units") or ([shape...], "units", T)
+            if (!jl_is_tuple(meta) || jl_nfields(meta) < 2 || jl_nfields(meta) > 3) {
+                std::cerr << "[ERROR] Expected metadata to be a 2- or 3-element tuple" << std::endl;
                 continue;
             }
 
@@ -267,8 +402,14 @@ void JuliaExplicitDiscipline::ExtractIOMetadata() {
                 units = jl_string_ptr(units_val);
             }
 
+            ElementType element_type =
+                jl_nfields(meta) == 3
+                    ? JuliaToElementType(jl_fieldref(meta, 2), name)
+                    : ElementType::kFloat64;
+            array_layouts_.SetElementType(name, element_type);
+
             // Add input to discipline
-            std::cout << "[DEBUG] ExtractIOMetadata: Adding input " << name << " with shape size " << shape.size() << " and units \"" << units << "\"" << std::endl;
+            std::cout << "[DEBUG] ExtractIOMetadata: Adding input " << name << " with shape size " << shape.size() << ", units \"" << units << "\" and element type " << ElementTypeName(element_type) << std::endl;
             AddInput(name, shape, units);
             std::cout << "[DEBUG] ExtractIOMetadata: Added input " << name << std::endl;
         }
@@ -283,9 +424,9 @@ void JuliaExplicitDiscipline::ExtractIOMetadata() {
     if (outputs_dict) {
         std::cout << "[DEBUG] ExtractIOMetadata: Processing outputs dict..." << std::endl;
 
-        jl_function_t* keys_fn = jl_get_function(jl_base_module, "keys");
-        jl_function_t* collect_fn = jl_get_function(jl_base_module, "collect");
-        jl_function_t* getindex_fn = jl_get_function(jl_base_module, "getindex");
+        jl_function_t* keys_fn = handles.keys_fn;
+        jl_function_t* collect_fn = handles.collect_fn;
+        jl_function_t* getindex_fn = handles.getindex_fn;
 
         jl_value_t* keys = jl_call1(keys_fn, outputs_dict);
         CheckJuliaException();
@@ -308,9 +449,10 @@ void JuliaExplicitDiscipline::ExtractIOMetadata() {
             jl_value_t* meta = jl_call2(getindex_fn, outputs_dict, key);
             CheckJuliaException();
 
-            // Metadata is a tuple (shape_vector, units_string) - access by index
-            if (!jl_is_tuple(meta) || jl_nfields(meta) != 2) {
-                std::cerr << "[ERROR] Expected output metadata to be a 2-element tuple" << std::endl;
+            // Metadata is a tuple (shape_vector, units_string[, element_type])
+            // - access by index
+            if (!jl_is_tuple(meta) || jl_nfields(meta) < 2 || jl_nfields(meta) > 3) {
+                std::cerr << "[ERROR] Expected output metadata to be a 2- or 3-element tuple" << std::endl;
                 continue;
             }
 
@@ -338,7 +480,13 @@ void JuliaExplicitDiscipline::ExtractIOMetadata() {
                 units = jl_string_ptr(units_val);
             }
 
-            std::cout << "[DEBUG] ExtractIOMetadata: Adding output " << name << " with shape size " << shape.size() << " and units \"" << units << "\"" << std::endl;
+            ElementType element_type =
+                jl_nfields(meta) == 3
+                    ? JuliaToElementType(jl_fieldref(meta, 2), name)
+                    : ElementType::kFloat64;
+            array_layouts_.SetElementType(name, element_type);
+
+            std::cout << "[DEBUG] ExtractIOMetadata: Adding output " << name << " with shape size " << shape.size() << ", units \"" << units << "\" and element type " << ElementTypeName(element_type) << std::endl;
             AddOutput(name, shape, units);
             std::cout << "[DEBUG] ExtractIOMetadata: Added output " << name << std::endl;
         }
@@ -360,35 +508,83 @@ void JuliaExplicitDiscipline::SetupPartials() {
 
         // Extract partials metadata
         ExtractPartialsMetadata();
+        partials_table_ = MakePartialsBlockTable(
+            var_meta(), partials_meta(), array_layouts_, sparsity_patterns_);
+
+        // Disciplines that return partials by block index receive the
+        // table as Dict{Tuple{String,String},Int}
+        jl_function_t* index_fn = GetJuliaFunction("set_partials_index!");
+        if (index_fn) {
+            JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+            jl_value_t* index = jl_call0(reinterpret_cast<jl_function_t*>(
+                handles.dict_pair_int_type));
+            CheckJuliaException();
+            GCProtect index_protect(index);
+
+            for (size_t k = 0; k < partials_table_.size(); ++k) {
+                const auto& [output, input] = partials_table_[k].key;
+                jl_value_t* output_str = jl_cstr_to_string(output.c_str());
+                GCProtect output_protect(output_str);
+                jl_value_t* input_str = jl_cstr_to_string(input.c_str());
+                GCProtect input_protect(input_str);
+                jl_value_t* key =
+                    jl_call2(handles.tuple_fn, output_str, input_str);
+                CheckJuliaException();
+                GCProtect key_protect(key);
+                jl_value_t* position = jl_box_int64(static_cast<int64_t>(k + 1));
+                GCProtect position_protect(position);
+                jl_call3(handles.setindex_fn, index, position, key);
+                CheckJuliaException();
+            }
+
+            jl_call2(index_fn, discipline_obj, index);
+            CheckJuliaException();
+        }
     });
 }
 
 void JuliaExplicitDiscipline::ExtractPartialsMetadata() {
     // Called from SetupPartials() which is already on Julia executor thread
     jl_value_t* discipline_obj = GetDisciplineObject();
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+    sparsity_patterns_.clear();
 
     // Get partials metadata from discipline
-    jl_function_t* getproperty_fn = jl_get_function(jl_base_module, "getproperty");
-    jl_value_t* partials_sym = reinterpret_cast<jl_value_t*>(jl_symbol("partials"));
+    jl_function_t* getproperty_fn = handles.getproperty_fn;
+    jl_sym_t* partials_sym = jl_symbol("partials");
+    if (jl_field_index(reinterpret_cast<jl_datatype_t*>(
+                           jl_typeof(discipline_obj)),
+                       partials_sym, 0) < 0) {
+        return;  // No partials defined
+    }
 
-    jl_value_t* partials_dict = jl_call2(getproperty_fn, discipline_obj, partials_sym);
+    jl_value_t* partials_dict = jl_call2(
+        getproperty_fn, discipline_obj,
+        reinterpret_cast<jl_value_t*>(partials_sym));
     CheckJuliaException();
 
-    if (!partials_dict || !1) {
+    if (!partials_dict) {
         return;  // No partials defined
     }
-
+    GCProtect dict_protect(partials_dict);
 
     // Iterate through partials
-    jl_function_t* keys_fn = jl_get_function(jl_base_module, "keys");
-    jl_function_t* collect_fn = jl_get_function(jl_base_module, "collect");
+    jl_function_t* keys_fn = handles.keys_fn;
+    jl_function_t* collect_fn = handles.collect_fn;
 
     jl_value_t* keys = jl_call1(keys_fn, partials_dict);
     CheckJuliaException();
+    GCProtect keys_protect(keys);
 
     jl_array_t* keys_array = reinterpret_cast<jl_array_t*>(
         jl_call1(collect_fn, keys));
     CheckJuliaException();
+    GCProtect keys_array_protect(reinterpret_cast<jl_value_t*>(keys_array));
+
+    std::map<std::string, std::vector<size_t>> shapes;
+    for (const auto& meta : var_meta()) {
+        shapes[meta.name()].assign(meta.shape().begin(), meta.shape().end());
+    }
 
     size_t num_partials = jl_array_len(keys_array);
 
@@ -408,92 +604,534 @@ void JuliaExplicitDiscipline::ExtractPartialsMetadata() {
 
         // Declare partial
         DeclarePartials(output, input);
+
+        // A (rows, cols) tuple of index vectors declares a sparsity pattern
+        jl_value_t* value = jl_call2(handles.getindex_fn, partials_dict, key);
+        CheckJuliaException();
+        if (!value || !jl_is_tuple(value) || jl_nfields(value) != 2) continue;
+
+        GCProtect value_protect(value);
+        jl_value_t* rows = jl_fieldref(value, 0);
+        jl_value_t* cols = jl_fieldref(value, 1);
+        jl_value_t* int_type = reinterpret_cast<jl_value_t*>(jl_int64_type);
+        if (!jl_is_array(rows) || !jl_is_array(cols) ||
+            jl_array_eltype(rows) != int_type ||
+            jl_array_eltype(cols) != int_type) {
+            throw std::runtime_error(
+                "Sparsity pattern of partial d" + output + "/d" + input +
+                " must be a tuple of two Vector{Int64}");
+        }
+
+        jl_array_t* rows_array = reinterpret_cast<jl_array_t*>(rows);
+        jl_array_t* cols_array = reinterpret_cast<jl_array_t*>(cols);
+        size_t nnz = jl_array_len(rows_array);
+        if (jl_array_len(cols_array) != nnz) {
+            throw std::runtime_error(
+                "Sparsity pattern of partial d" + output + "/d" + input +
+                " has rows and cols of different lengths");
+        }
+        if (!shapes.count(output) || !shapes.count(input)) {
+            throw std::runtime_error("Sparse partial d" + output + "/d" +
+                                     input + " refers to an unknown variable");
+        }
+
+        sparsity_patterns_[{output, input}] =
+            std::make_shared<const SparsityPattern>(MakeSparsityPattern(
+                jl_array_data(rows_array, int64_t),
+                jl_array_data(cols_array, int64_t), nnz, shapes[output],
+                shapes[input], array_layouts_.GetPartial(output, input)));
     }
 }
 
-void JuliaExplicitDiscipline::Compute(const philote::Variables& inputs,
-                                      philote::Variables& outputs) {
-    // Execute on dedicated Julia thread - NO CONCURRENCY
-    outputs = JuliaExecutor::GetInstance().Submit([this, &inputs]() {
-        // All Julia calls happen on single executor thread
-        jl_value_t* discipline_obj = GetDisciplineObject();
+void JuliaExplicitDiscipline::ResolveArrayLayouts() {
+    ArrayLayout default_layout = ArrayLayout::kRowMajor;
+    std::map<std::string, ArrayLayout> declared;
 
-        jl_value_t* inputs_dict = VariablesToJuliaDict(inputs);
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+    jl_function_t* layout_fn = GetDisciplineMethod("array_layout");
+    if (layout_fn) {
+        jl_value_t* value = jl_call1(layout_fn, GetDisciplineObject());
+        CheckJuliaException();
+        GCProtect value_protect(value);
 
-        jl_function_t* compute_fn = GetJuliaFunction("compute");
-        if (!compute_fn) {
-            throw std::runtime_error(
-                "Julia discipline missing required function: compute()");
+        if (value && (jl_is_string(value) || jl_is_symbol(value))) {
+            default_layout = JuliaToArrayLayout(value);
+        } else {
+            // Dict of variable name => layout
+            jl_value_t* keys = jl_call1(handles.keys_fn, value);
+            CheckJuliaException();
+            GCProtect keys_protect(keys);
+            jl_array_t* keys_array = reinterpret_cast<jl_array_t*>(
+                jl_call1(handles.collect_fn, keys));
+            CheckJuliaException();
+            GCProtect keys_array_protect(
+                reinterpret_cast<jl_value_t*>(keys_array));
+
+            for (size_t i = 0; i < jl_array_len(keys_array); ++i) {
+                jl_value_t* key = jl_array_ptr_ref(keys_array, i);
+                if (!jl_is_string(key)) {
+                    throw std::runtime_error(
+                        "array_layout() keys must be variable names");
+                }
+                jl_value_t* layout = jl_call2(handles.getindex_fn, value, key);
+                CheckJuliaException();
+                declared[jl_string_ptr(key)] = JuliaToArrayLayout(layout);
+            }
         }
+    }
 
-        jl_value_t* result = jl_call2(compute_fn, discipline_obj, inputs_dict);
-        CheckJuliaException();
+    // YAML settings override the discipline's at the same level
+    if (!config_.array_layout.empty()) {
+        default_layout = ParseArrayLayout(config_.array_layout);
+    }
+    ArrayLayoutMap layouts(default_layout);
+    for (const auto& [name, layout] : declared) {
+        layouts.Set(name, layout);
+    }
+    for (const auto& [name, layout] : config_.variable_layouts) {
+        layouts.Set(name, ParseArrayLayout(layout));
+    }
+    array_layouts_ = std::move(layouts);
+}
 
-        if (!result) {
-            throw std::runtime_error("Julia compute() returned null");
+void JuliaExplicitDiscipline::CheckArrayLayoutNames() {
+    std::set<std::string> variables;
+    for (const auto& meta : var_meta()) {
+        variables.insert(meta.name());
+    }
+
+    // A variable name may itself contain '~' (block-indexed partials)
+    for (const std::string& name : array_layouts_.OverriddenNames()) {
+        if (variables.count(name)) {
+            continue;
+        }
+        size_t tilde = name.find('~');
+        if (tilde != std::string::npos &&
+            variables.count(name.substr(0, tilde)) &&
+            variables.count(name.substr(tilde + 1))) {
+            continue;
         }
+        throw std::runtime_error("Array layout given for '" + name +
+                                 "', which is not a variable or partial of "
+                                 "the discipline");
+    }
+}
 
-        return JuliaDictToVariables(result);
-    });
+philote::Variables JuliaExplicitDiscipline::AllocateInputs() {
+    philote::Variables inputs;
+    for (const auto& meta : var_meta()) {
+        if (meta.type() == philote::kInput) {
+            inputs[meta.name()] = philote::Variable(meta);
+        }
+    }
+    return inputs;
 }
 
-void JuliaExplicitDiscipline::ComputePartials(const philote::Variables& inputs,
-                                              philote::Partials& partials) {
-    std::cout << "[DEBUG] ComputePartials() called" << std::endl;
-    std::cout.flush();
-    // Execute on dedicated Julia thread - NO CONCURRENCY
-    partials = JuliaExecutor::GetInstance().Submit([this, &inputs]() {
-        std::cout << "[DEBUG] ComputePartials lambda starting..." << std::endl;
-        std::cout.flush();
-        jl_value_t* discipline_obj = GetDisciplineObject();
+philote::Variables JuliaExplicitDiscipline::AllocateOutputs() {
+    philote::Variables outputs;
+    for (const auto& meta : var_meta()) {
+        if (meta.type() == philote::kOutput) {
+            outputs[meta.name()] = philote::Variable(meta);
+        }
+    }
+    return outputs;
+}
 
-        std::cout << "[DEBUG] Converting inputs to Julia dict..." << std::endl;
-        std::cout.flush();
-        // Convert inputs
-        jl_value_t* inputs_dict = VariablesToJuliaDict(inputs);
+philote::Variables JuliaExplicitDiscipline::RunCompute(
+    const philote::Variables& inputs) {
+    static MethodStats& stats =
+        RequestTelemetry::GetInstance().Method("compute");
+    TelemetryScope telemetry(stats);
 
-        std::cout << "[DEBUG] Getting compute_partials function..." << std::endl;
-        std::cout.flush();
-        // Call Julia compute_partials function
-        jl_function_t* compute_partials_fn = GetJuliaFunction("compute_partials");
-        if (!compute_partials_fn) {
-            throw std::runtime_error(
-                "Julia discipline missing function: compute_partials()");
+    if (has_compute_packed_) {
+        return RunComputePacked(inputs);
+    }
+
+    // compute! needs the output metadata, which Setup() provides
+    if (has_compute_inplace_) {
+        philote::Variables outputs = AllocateOutputs();
+        if (!outputs.empty()) {
+            RunComputeInPlace(inputs, outputs);
+            return outputs;
         }
+    }
 
-        std::cout << "[DEBUG] Calling Julia compute_partials()..." << std::endl;
-        std::cout.flush();
-        jl_value_t* result =
-            jl_call2(compute_partials_fn, discipline_obj, inputs_dict);
-        CheckJuliaException();
+    // All Julia calls happen on an executor worker
+    jl_value_t* discipline_obj = GetDisciplineObject();
+
+    // inputs outlive this call, which is the only place Julia sees them
+    jl_value_t* inputs_dict = InputsToJulia(inputs);
+
+    jl_function_t* compute_fn = GetJuliaFunction("compute");
+    if (!compute_fn) {
+        throw std::runtime_error(
+            "Julia discipline missing required function: compute()");
+    }
+
+    jl_value_t* result = jl_call2(compute_fn, discipline_obj, inputs_dict);
+    CheckJuliaException();
+
+    if (!result) {
+        throw std::runtime_error("Julia compute() returned null");
+    }
+
+    return JuliaDictToVariables(result, array_layouts_, &variable_converters_);
+}
+
+std::vector<philote::Variables> JuliaExplicitDiscipline::RunComputeBatch(
+    const std::vector<const philote::Variables*>& points) {
+    if (points.size() == 1 || !has_compute_batch_) {
+        std::vector<philote::Variables> outputs;
+        outputs.reserve(points.size());
+        for (const philote::Variables* point : points) {
+            outputs.push_back(RunCompute(*point));
+        }
+        return outputs;
+    }
+
+    static MethodStats& stats =
+        RequestTelemetry::GetInstance().Method("compute_batch");
+    TelemetryScope telemetry(stats);
+
+    jl_value_t* discipline_obj = GetDisciplineObject();
 
-        std::cout << "[DEBUG] compute_partials returned: " << result << std::endl;
-        std::cout.flush();
-        if (!result) {
-            throw std::runtime_error("Julia compute_partials() returned null");
+    jl_value_t* inputs_dict = StackedVariablesToJuliaDict(
+        points, array_layouts_, &variable_converters_);
+    GCProtect inputs_protect(inputs_dict);
+
+    jl_function_t* compute_batch_fn = GetJuliaFunction("compute_batch");
+    if (!compute_batch_fn) {
+        throw std::runtime_error(
+            "Julia discipline missing function: compute_batch()");
+    }
+
+    jl_value_t* result = jl_call2(compute_batch_fn, discipline_obj, inputs_dict);
+    CheckJuliaException();
+
+    if (!result) {
+        throw std::runtime_error("Julia compute_batch() returned null");
+    }
+    GCProtect result_protect(result);
+
+    // Scatter by the declared output shapes
+    std::map<std::string, std::vector<size_t>> output_shapes;
+    for (const auto& meta : var_meta()) {
+        if (meta.type() == philote::kOutput) {
+            output_shapes[meta.name()] =
+                std::vector<size_t>(meta.shape().begin(), meta.shape().end());
         }
+    }
+
+    return JuliaDictToStackedVariables(result, output_shapes, points.size(),
+                                       array_layouts_, &variable_converters_);
+}
+
+void JuliaExplicitDiscipline::RunComputeInPlace(
+    const philote::Variables& inputs, philote::Variables& outputs) {
+    jl_value_t* discipline_obj = GetDisciplineObject();
+
+    jl_function_t* compute_inplace_fn = GetJuliaFunction("compute!");
+    if (!compute_inplace_fn) {
+        throw std::runtime_error(
+            "Julia discipline missing function: compute!()");
+    }
+
+    jl_value_t* inputs_dict = InputsToJulia(inputs);
+    GCProtect inputs_protect(inputs_dict);
+
+    // This worker's output dict, or a one-off dict off the executor
+    int worker = JuliaExecutor::CurrentWorkerIndex();
+    bool pooled = worker >= 0 &&
+                  static_cast<size_t>(worker) < output_dicts_.size();
+    JuliaReusableDict one_off;
+    JuliaReusableDict& output_dict = pooled ? output_dicts_[worker] : one_off;
+    if (!output_dict.Matches(outputs)) {
+        jl_value_t* dict = output_dict.Reset(outputs, false, array_layouts_);
+        if (pooled) {
+            dict_roots_[output_dicts_.size() + worker].Set(dict);
+        }
+    }
+    jl_value_t* outputs_dict = output_dict.dict();
+    GCProtect outputs_protect(outputs_dict);
+
+    jl_call3(compute_inplace_fn, discipline_obj, inputs_dict, outputs_dict);
+    CheckJuliaException();
+
+    output_dict.Read(outputs);
+}
+
+void JuliaExplicitDiscipline::CompileNativeCompute() {
+    if (!GetJuliaFunction("_philote_native_compute")) {
+        JuliaRuntime::GetInstance().EvalString(kNativeComputeSource);
+    }
+    jl_function_t* make_fn = GetJuliaFunction("_philote_native_compute");
+
+    // Closure cfunctions are not available on every platform
+    jl_value_t* native = nullptr;
+    try {
+        native = jl_call1(make_fn, GetDisciplineObject());
+        CheckJuliaException();
+    } catch (const std::exception& e) {
+        native = nullptr;
+        std::cerr << "[WARNING] " << e.what() << std::endl;
+    }
+    if (!native || !jl_is_tuple(native)) {
+        std::cerr << "[WARNING] Could not compile a native compute_packed!; "
+                  << "using jl_call" << std::endl;
+        return;
+    }
+
+    // The CFunction keeps the closure, and so the pointer, alive
+    native_root_.Set(native);
 
-        std::cout << "[DEBUG] Converting result to C++ partials..." << std::endl;
-        std::cout.flush();
-        philote::Partials result_partials = JuliaDictToPartials(result);
+    native_compute_ = reinterpret_cast<NativeComputeFn>(
+        jl_unbox_voidpointer(jl_fieldref(native, 1)));
+}
+
+void JuliaExplicitDiscipline::BuildPackedIndexes() {
+    packed_inputs_ =
+        MakePackedIndex(var_meta(), philote::kInput, array_layouts_);
+    packed_outputs_ =
+        MakePackedIndex(var_meta(), philote::kOutput, array_layouts_);
+    if (has_compute_packed_ && array_layouts_.has_element_types()) {
+        std::cerr << "[WARNING] compute_packed!() buffers are Vector{Float64}; "
+                  << "Float32 variables are passed to it as Float64"
+                  << std::endl;
+    }
 
-        std::cout << "[DEBUG] Converted " << result_partials.size() << " partial(s):" << std::endl;
-        for (const auto& [key, value] : result_partials) {
-            std::cout << "[DEBUG]   d" << key.first << "/d" << key.second
-                      << " = [" << value.Size() << " elements]";
-            if (value.Size() > 0) {
-                std::cout << " first value = " << value(0);
+    jl_function_t* index_fn = GetJuliaFunction("set_packed_index!");
+    if (!index_fn) {
+        return;
+    }
+
+    // Dict{String,UnitRange{Int}} of 1-based ranges into each buffer
+    JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+    auto to_julia = [&](const PackedIndex& index) {
+        jl_value_t* dict = jl_call0(reinterpret_cast<jl_function_t*>(
+            handles.dict_string_range_type));
+        CheckJuliaException();
+        GCProtect dict_protect(dict);
+        for (const PackedSlot& slot : index.slots) {
+            jl_value_t* first =
+                jl_box_int64(static_cast<int64_t>(slot.offset + 1));
+            GCProtect first_protect(first);
+            jl_value_t* last =
+                jl_box_int64(static_cast<int64_t>(slot.offset + slot.size));
+            GCProtect last_protect(last);
+            jl_value_t* range = jl_call2(handles.colon_fn, first, last);
+            CheckJuliaException();
+            GCProtect range_protect(range);
+            jl_value_t* name = jl_cstr_to_string(slot.name.c_str());
+            GCProtect name_protect(name);
+            jl_call3(handles.setindex_fn, dict, range, name);
+            CheckJuliaException();
+        }
+        return dict;
+    };
+
+    jl_value_t* inputs_index = to_julia(packed_inputs_);
+    GCProtect inputs_protect(inputs_index);
+    jl_value_t* outputs_index = to_julia(packed_outputs_);
+    GCProtect outputs_protect(outputs_index);
+    jl_call3(index_fn, GetDisciplineObject(), inputs_index, outputs_index);
+    CheckJuliaException();
+}
+
+philote::Variables JuliaExplicitDiscipline::RunComputePacked(
+    const philote::Variables& inputs) {
+    // This worker's buffers, allocated on first use, or one-off buffers off
+    // the executor
+    int worker = JuliaExecutor::CurrentWorkerIndex();
+    bool pooled = worker >= 0 &&
+                  2 * static_cast<size_t>(worker) + 1 < packed_roots_.size();
+    auto buffer = [&](size_t slot, size_t size) {
+        jl_value_t* array = pooled ? packed_roots_[slot].get() : nullptr;
+        if (!array ||
+            jl_array_len(reinterpret_cast<jl_array_t*>(array)) != size) {
+            array = reinterpret_cast<jl_value_t*>(jl_alloc_array_1d(
+                JuliaRuntime::GetInstance().Handles().vector_float64_type,
+                size));
+            if (pooled) {
+                packed_roots_[slot].Set(array);
             }
-            std::cout << std::endl;
         }
-        std::cout.flush();
+        return array;
+    };
+
+    size_t base = pooled ? 2 * static_cast<size_t>(worker) : 0;
+    jl_value_t* inputs_array = buffer(base, packed_inputs_.size);
+    GCProtect inputs_protect(inputs_array);
+    jl_value_t* outputs_array = buffer(base + 1, packed_outputs_.size);
+    GCProtect outputs_protect(outputs_array);
+
+    PackVariables(inputs, packed_inputs_,
+                  jl_array_data(reinterpret_cast<jl_array_t*>(inputs_array),
+                                double));
+    // Pooled buffers hold the last request's outputs, and new ones are
+    // uninitialized; an output compute_packed! skips must not leak either
+    double* outputs_data =
+        jl_array_data(reinterpret_cast<jl_array_t*>(outputs_array), double);
+    std::fill(outputs_data, outputs_data + packed_outputs_.size, 0.0);
+
+    if (native_compute_) {
+        char message[1024];
+        int status = native_compute_(inputs_array, outputs_array, message,
+                                     sizeof(message));
+        if (status != 0) {
+            throw std::runtime_error(std::string("Julia compute_packed!(): ") +
+                                     message);
+        }
+    } else {
+        jl_function_t* compute_packed_fn = GetJuliaFunction("compute_packed!");
+        if (!compute_packed_fn) {
+            throw std::runtime_error(
+                "Julia discipline missing function: compute_packed!()");
+        }
+        jl_call3(compute_packed_fn, GetDisciplineObject(), inputs_array,
+                 outputs_array);
+        CheckJuliaException();
+    }
 
-        return result_partials;
-    });
+    return UnpackVariables(outputs_data, packed_outputs_);
+}
+
+jl_value_t* JuliaExplicitDiscipline::InputsToJulia(
+    const philote::Variables& inputs) {
+    int worker = JuliaExecutor::CurrentWorkerIndex();
+    if (input_dicts_.empty() || worker < 0 ||
+        static_cast<size_t>(worker) >= input_dicts_.size()) {
+        return config_.zero_copy_inputs
+                   ? WrapVariablesAsJuliaDict(inputs, array_layouts_,
+                                              &variable_converters_)
+                   : VariablesToJuliaDict(inputs, array_layouts_,
+                                          &variable_converters_);
+    }
+
+    // Tasks on one worker never overlap, so its dict has a single user
+    JuliaReusableDict& cached = input_dicts_[worker];
+    if (jl_value_t* dict = cached.Update(inputs)) {
+        return dict;
+    }
+
+    // First call on this worker, or the input layout changed
+    jl_value_t* dict =
+        cached.Reset(inputs, config_.zero_copy_inputs, array_layouts_);
+    dict_roots_[worker].Set(dict);
+    return dict;
+}
+
+std::pair<philote::Partials, SparsePartials>
+JuliaExplicitDiscipline::RunComputeSparsePartials(
+    const philote::Variables& inputs) {
+    static MethodStats& stats =
+        RequestTelemetry::GetInstance().Method("compute_partials");
+    TelemetryScope telemetry(stats);
+
+    jl_value_t* discipline_obj = GetDisciplineObject();
+
+    // Convert inputs
+    jl_value_t* inputs_dict = InputsToJulia(inputs);
+
+    // Call Julia compute_partials function
+    jl_function_t* compute_partials_fn = GetJuliaFunction("compute_partials");
+    if (!compute_partials_fn) {
+        throw std::runtime_error(
+            "Julia discipline missing function: compute_partials()");
+    }
+
+    jl_value_t* result =
+        jl_call2(compute_partials_fn, discipline_obj, inputs_dict);
+    CheckJuliaException();
+    if (!result) {
+        throw std::runtime_error("Julia compute_partials() returned null");
+    }
+
+    // A Vector is block-indexed (see set_partials_index!), a Dict keyed by
+    // "output~input"
+    SparsePartials sparse;
+    philote::Partials result_partials =
+        jl_is_array(result)
+            ? JuliaBlocksToPartials(result, partials_table_, sparse)
+            : JuliaDictToSparsePartials(result, sparsity_patterns_, sparse,
+                                        array_layouts_, &partials_table_);
+
+    return {std::move(result_partials), std::move(sparse)};
+}
+
+philote::Partials JuliaExplicitDiscipline::RunComputePartials(
+    const philote::Variables& inputs) {
+    auto [partials, sparse] = RunComputeSparsePartials(inputs);
+    for (const auto& [key, block] : sparse) {
+        partials[key] = DensifyPartial(block);
+    }
+    return partials;
+}
+
+void JuliaExplicitDiscipline::Compute(const philote::Variables& inputs,
+                                      philote::Variables& outputs) {
+    if (batcher_) {
+        outputs = batcher_->Submit(inputs);
+        return;
+    }
+
+    // Execute on a Julia executor worker (serialized unless thread-safe)
+    outputs = JuliaExecutor::GetInstance().Submit(
+        [this, &inputs]() { return RunCompute(inputs); }, ComputeAffinity());
+}
+
+void JuliaExplicitDiscipline::ComputePartials(const philote::Variables& inputs,
+                                              philote::Partials& partials) {
+    std::cout << "[DEBUG] ComputePartials() called" << std::endl;
+    std::cout.flush();
+    // Execute on a Julia executor worker (serialized unless thread-safe)
+    partials = JuliaExecutor::GetInstance().Submit(
+        [this, &inputs]() { return RunComputePartials(inputs); },
+        ComputeAffinity());
     std::cout << "[DEBUG] ComputePartials() completed, returning " << partials.size() << " partial(s)" << std::endl;
     std::cout.flush();
 }
 
+TaskHandle<philote::Variables> JuliaExplicitDiscipline::ComputeAsync(
+    const philote::Variables& inputs) {
+    if (batcher_) {
+        return batcher_->SubmitAsync(inputs);
+    }
+    return JuliaExecutor::GetInstance().SubmitAsync(
+        [this, &inputs]() { return RunCompute(inputs); }, ComputeAffinity());
+}
+
+std::vector<philote::Variables> JuliaExplicitDiscipline::ComputeMultiPoint(
+    const std::vector<philote::Variables>& points) {
+    if (points.empty()) {
+        return {};
+    }
+
+    std::vector<const philote::Variables*> pointers;
+    pointers.reserve(points.size());
+    for (const auto& point : points) {
+        pointers.push_back(&point);
+    }
+
+    return JuliaExecutor::GetInstance().Submit(
+        [this, &pointers]() { return RunComputeBatch(pointers); },
+        ComputeAffinity());
+}
+
+void JuliaExplicitDiscipline::ComputeSparsePartials(
+    const philote::Variables& inputs, philote::Partials& dense,
+    SparsePartials& sparse) {
+    std::tie(dense, sparse) = JuliaExecutor::GetInstance().Submit(
+        [this, &inputs]() { return RunComputeSparsePartials(inputs); },
+        ComputeAffinity());
+}
+
+TaskHandle<philote::Partials> JuliaExplicitDiscipline::ComputePartialsAsync(
+    const philote::Variables& inputs) {
+    return JuliaExecutor::GetInstance().SubmitAsync(
+        [this, &inputs]() { return RunComputePartials(inputs); },
+        ComputeAffinity());
+}
+
 void JuliaExplicitDiscipline::SetOptions(
     const google::protobuf::Struct& options) {
     // Execute on dedicated Julia thread
@@ -516,20 +1154,36 @@ void JuliaExplicitDiscipline::SetOptions(
 }
 
 jl_value_t* JuliaExplicitDiscipline::GetDisciplineObject() {
-    // Return C++ member variable directly
-    // GC protection is handled by GCProtect when we use it
-    if (!discipline_obj_) {
+    // Rooted in the runtime's root pool for the discipline's lifetime
+    jl_value_t* discipline_obj = discipline_obj_.get();
+    if (!discipline_obj) {
         throw std::runtime_error("Discipline object not initialized");
     }
-    return discipline_obj_;
+    return discipline_obj;
 }
 
 jl_function_t* JuliaExplicitDiscipline::GetJuliaFunction(
     const std::string& name) {
     // Functions are always defined in Main module (where we include() the Julia file)
-    jl_module_t* main_module = jl_main_module;
-    jl_function_t* fn = jl_get_function(main_module, name.c_str());
-    return fn;
+    return JuliaRuntime::GetInstance().Handles().MainFunction(name);
+}
+
+jl_function_t* JuliaExplicitDiscipline::GetDisciplineMethod(
+    const std::string& name) {
+    jl_function_t* fn = GetJuliaFunction(name);
+    if (!fn) {
+        return nullptr;
+    }
+    if (!GetJuliaFunction("_philote_has_method")) {
+        JuliaRuntime::GetInstance().EvalString(kDisciplineHelpersSource);
+    }
+    jl_value_t* has_method =
+        jl_call2(GetJuliaFunction("_philote_has_method"),
+                 reinterpret_cast<jl_value_t*>(fn), GetDisciplineObject());
+    CheckJuliaException();
+    return has_method && jl_is_bool(has_method) && jl_unbox_bool(has_method)
+               ? fn
+               : nullptr;
 }
 
 }  // namespace julia
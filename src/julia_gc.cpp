@@ -3,76 +3,136 @@
 
 #include "julia_gc.h"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 namespace philote {
 namespace julia {
 
-GCProtect::GCProtect(jl_value_t* obj) : count_(1) {
-    protected_objects_.push_back(obj);
-    JL_GC_PUSH1(&protected_objects_[0]);
-}
+namespace {
 
-GCProtect::GCProtect(std::initializer_list<jl_value_t*> objs)
-    : protected_objects_(objs), count_(objs.size()) {
-    // Use appropriate JL_GC_PUSH macro based on count
-    switch (count_) {
-        case 0:
-            break;
-        case 1: {
-            JL_GC_PUSH1(&protected_objects_[0]);
-            break;
-        }
-        case 2: {
-            JL_GC_PUSH2(&protected_objects_[0], &protected_objects_[1]);
-            break;
-        }
-        case 3: {
-            JL_GC_PUSH3(&protected_objects_[0], &protected_objects_[1],
-                        &protected_objects_[2]);
-            break;
-        }
-        case 4: {
-            JL_GC_PUSH4(&protected_objects_[0], &protected_objects_[1],
-                        &protected_objects_[2], &protected_objects_[3]);
-            break;
-        }
-        case 5: {
-            JL_GC_PUSH5(&protected_objects_[0], &protected_objects_[1],
-                        &protected_objects_[2], &protected_objects_[3],
-                        &protected_objects_[4]);
-            break;
-        }
-        case 6: {
-            JL_GC_PUSH6(&protected_objects_[0], &protected_objects_[1],
-                        &protected_objects_[2], &protected_objects_[3],
-                        &protected_objects_[4], &protected_objects_[5]);
-            break;
-        }
-        case 7: {
-            JL_GC_PUSH7(&protected_objects_[0], &protected_objects_[1],
-                        &protected_objects_[2], &protected_objects_[3],
-                        &protected_objects_[4], &protected_objects_[5],
-                        &protected_objects_[6]);
-            break;
+/**
+ * Per-thread stack of GC frames too large for the C++ stack
+ *
+ * Frames are carved out of fixed chunks that are never moved or freed, and
+ * released in reverse order by returning to the position saved when they
+ * were taken, so steady-state use allocates nothing.
+ */
+class RootArena {
+public:
+    static constexpr size_t kChunkSlots = 1024;
+
+    // Take n pointer-sized slots, saving the previous position in mark_*
+    void** Take(size_t n, size_t& mark_chunk, size_t& mark_used) {
+        mark_chunk = current_;
+        mark_used = used_;
+        if (current_ < chunks_.size() && used_ + n <= chunks_[current_].size) {
+            void** slots = chunks_[current_].slots.get() + used_;
+            used_ += n;
+            return slots;
         }
-        case 8: {
-            JL_GC_PUSH8(&protected_objects_[0], &protected_objects_[1],
-                        &protected_objects_[2], &protected_objects_[3],
-                        &protected_objects_[4], &protected_objects_[5],
-                        &protected_objects_[6], &protected_objects_[7]);
-            break;
+
+        // Chunks past the current one are free, so a small one is replaced
+        size_t next = chunks_.empty() ? 0 : current_ + 1;
+        if (next == chunks_.size()) {
+            chunks_.emplace_back();
         }
-        default: {
-            // For more than 8 objects, use PUSHARGS
-            jl_value_t** args = protected_objects_.data();
-            JL_GC_PUSHARGS(args, count_);
-            break;
+        Chunk& chunk = chunks_[next];
+        if (chunk.size < n) {
+            chunk.size = std::max(kChunkSlots, n);
+            chunk.slots = std::make_unique<void*[]>(chunk.size);
         }
+        current_ = next;
+        used_ = n;
+        return chunk.slots.get();
+    }
+
+    void Release(size_t mark_chunk, size_t mark_used) {
+        current_ = mark_chunk;
+        used_ = mark_used;
+    }
+
+private:
+    struct Chunk {
+        std::unique_ptr<void*[]> slots;
+        size_t size = 0;
+    };
+
+    std::vector<Chunk> chunks_;
+    size_t current_ = 0;
+    size_t used_ = 0;
+};
+
+thread_local RootArena root_arena;
+
+// Fill in a frame header for n roots and link it onto the GC stack
+void LinkFrame(void** frame, size_t n) {
+    frame[0] = reinterpret_cast<void*>(JL_GC_ENCODE_PUSHARGS(n));
+    frame[1] = jl_pgcstack;
+    jl_pgcstack = reinterpret_cast<jl_gcframe_t*>(frame);
+}
+
+void UnlinkFrame(void** frame) {
+    jl_pgcstack = static_cast<jl_gcframe_t*>(frame[1]);
+}
+
+}  // namespace
+
+GCArenaFrame::GCArenaFrame(size_t n) : size_(n) {
+    void** frame = root_arena.Take(2 + n, mark_chunk_, mark_used_);
+    roots_ = reinterpret_cast<jl_value_t**>(frame + 2);
+    std::fill(roots_, roots_ + n, nullptr);
+    LinkFrame(frame, n);
+}
+
+GCArenaFrame::~GCArenaFrame() {
+    UnlinkFrame(reinterpret_cast<void**>(roots_) - 2);
+    root_arena.Release(mark_chunk_, mark_used_);
+}
+
+GCProtect::GCProtect(jl_value_t* obj) {
+    Push(&obj, 1);
+}
+
+GCProtect::GCProtect(std::initializer_list<jl_value_t*> objs) {
+    Push(objs.begin(), objs.size());
+}
+
+void GCProtect::Push(const jl_value_t* const* objs, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    frame_ = count <= kInlineRoots
+                 ? inline_frame_
+                 : root_arena.Take(2 + count, mark_chunk_, mark_used_);
+    for (size_t i = 0; i < count; ++i) {
+        frame_[2 + i] = const_cast<jl_value_t*>(objs[i]);
     }
+    LinkFrame(frame_, count);
 }
 
 GCProtect::~GCProtect() {
-    if (count_ > 0) {
-        JL_GC_POP();
+    if (frame_ == nullptr) {
+        return;
+    }
+    UnlinkFrame(frame_);
+    if (frame_ != inline_frame_) {
+        root_arena.Release(mark_chunk_, mark_used_);
+    }
+}
+
+GCSafeRegion::GCSafeRegion() {
+    // jl_get_pgcstack() is null on threads that were never adopted
+    if (jl_get_pgcstack() != nullptr) {
+        ptls_ = jl_current_task->ptls;
+        state_ = jl_gc_safe_enter(ptls_);
+    }
+}
+
+GCSafeRegion::~GCSafeRegion() {
+    if (ptls_) {
+        jl_gc_safe_leave(ptls_, state_);
     }
 }
 
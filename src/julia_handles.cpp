@@ -0,0 +1,128 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_handles.h"
+
+#include <mutex>
+#include <stdexcept>
+
+namespace philote {
+namespace julia {
+
+namespace {
+
+jl_function_t* RequireBaseFunction(const char* name) {
+    jl_function_t* fn = jl_get_function(jl_base_module, name);
+    if (!fn) {
+        throw std::runtime_error(std::string("Could not find Base.") + name);
+    }
+    return fn;
+}
+
+jl_value_t* ApplyDictType(
+    jl_value_t* dict_type, jl_value_t* value_type,
+    jl_value_t* key_type = reinterpret_cast<jl_value_t*>(jl_string_type)) {
+    jl_value_t* params[2] = {key_type, value_type};
+    jl_value_t* type = jl_apply_type(dict_type, params, 2);
+    if (jl_exception_occurred() || !type) {
+        jl_exception_clear();
+        throw std::runtime_error("Could not instantiate Dict type");
+    }
+    return type;
+}
+
+}  // namespace
+
+void JuliaHandleCache::Populate() {
+    jl_value_t* float64 = reinterpret_cast<jl_value_t*>(jl_float64_type);
+    for (ElementType type : {ElementType::kFloat64, ElementType::kFloat32}) {
+        for (size_t rank = 0; rank <= kMaxCachedRank; ++rank) {
+            array_types_[static_cast<size_t>(type)][rank] =
+                jl_apply_array_type(ElementJuliaType(type), rank);
+        }
+    }
+    vector_float64_type = ArrayType(ElementType::kFloat64, 1);
+    matrix_float64_type = ArrayType(ElementType::kFloat64, 2);
+
+    jl_value_t* dict_type = jl_get_global(jl_base_module, jl_symbol("Dict"));
+    if (!dict_type) {
+        throw std::runtime_error("Could not find Base.Dict type");
+    }
+    dict_string_vector_type = ApplyDictType(dict_type, vector_float64_type);
+    dict_string_matrix_type = ApplyDictType(dict_type, matrix_float64_type);
+    jl_value_t* array_type = reinterpret_cast<jl_value_t*>(jl_array_type);
+    dict_string_array_type =
+        ApplyDictType(dict_type, jl_apply_type1(array_type, float64));
+    dict_string_vector32_type =
+        ApplyDictType(dict_type, ArrayType(ElementType::kFloat32, 1));
+    dict_string_array32_type = ApplyDictType(
+        dict_type,
+        jl_apply_type1(array_type, ElementJuliaType(ElementType::kFloat32)));
+    dict_string_any_array_type = ApplyDictType(dict_type, array_type);
+    dict_string_matrix32_type =
+        ApplyDictType(dict_type, ArrayType(ElementType::kFloat32, 2));
+    jl_value_t* matrix_type = jl_get_global(jl_core_module, jl_symbol("Matrix"));
+    if (!matrix_type) {
+        throw std::runtime_error("Could not find Core.Matrix type");
+    }
+    dict_string_any_matrix_type = ApplyDictType(dict_type, matrix_type);
+
+    jl_value_t* int_type = reinterpret_cast<jl_value_t*>(jl_long_type);
+    jl_value_t* range_type =
+        jl_get_global(jl_base_module, jl_symbol("UnitRange"));
+    if (!range_type) {
+        throw std::runtime_error("Could not find Base.UnitRange type");
+    }
+    dict_string_range_type =
+        ApplyDictType(dict_type, jl_apply_type1(range_type, int_type));
+    jl_value_t* pair_params[2] = {
+        reinterpret_cast<jl_value_t*>(jl_string_type),
+        reinterpret_cast<jl_value_t*>(jl_string_type)};
+    jl_value_t* pair_type = reinterpret_cast<jl_value_t*>(
+        jl_apply_tuple_type_v(pair_params, 2));
+    dict_pair_int_type = ApplyDictType(dict_type, int_type, pair_type);
+
+    dict_fn = RequireBaseFunction("Dict");
+    setindex_fn = RequireBaseFunction("setindex!");
+    getindex_fn = RequireBaseFunction("getindex");
+    getproperty_fn = RequireBaseFunction("getproperty");
+    keys_fn = RequireBaseFunction("keys");
+    collect_fn = RequireBaseFunction("collect");
+    sprint_fn = RequireBaseFunction("sprint");
+    showerror_fn = RequireBaseFunction("showerror");
+    tuple_fn = RequireBaseFunction("tuple");
+    colon_fn = RequireBaseFunction(":");
+}
+
+jl_function_t* JuliaHandleCache::MainFunction(const std::string& name) {
+    uint64_t generation;
+    {
+        std::shared_lock<std::shared_mutex> lock(main_mutex_);
+        auto it = main_functions_.find(name);
+        if (it != main_functions_.end()) {
+            return it->second;
+        }
+        generation = main_generation_;
+    }
+
+    // Resolve outside the lock: workers must not block on a mutex while a
+    // Julia call on another worker waits for them to reach a safepoint
+    jl_function_t* fn = jl_get_function(jl_main_module, name.c_str());
+
+    // Main may have been reloaded while we looked; the result is still
+    // this call's answer, but must not outlive the invalidation
+    std::unique_lock<std::shared_mutex> lock(main_mutex_);
+    if (main_generation_ == generation) {
+        main_functions_.emplace(name, fn);
+    }
+    return fn;
+}
+
+void JuliaHandleCache::InvalidateMainFunctions() {
+    std::unique_lock<std::shared_mutex> lock(main_mutex_);
+    main_functions_.clear();
+    ++main_generation_;
+}
+
+}  // namespace julia
+}  // namespace philote
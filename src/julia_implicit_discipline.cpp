@@ -6,6 +6,7 @@
 #include "julia_convert.h"
 #include "julia_gc.h"
 #include "julia_runtime.h"
+#include "julia_telemetry.h"
 #include "julia_thread.h"
 
 namespace philote {
@@ -13,7 +14,7 @@ namespace julia {
 
 JuliaImplicitDiscipline::JuliaImplicitDiscipline(
     const DisciplineConfig& config)
-    : config_(config), module_(nullptr), discipline_obj_(nullptr) {
+    : config_(config), module_(nullptr) {
 }
 
 JuliaImplicitDiscipline::~JuliaImplicitDiscipline() {
@@ -38,32 +39,23 @@ void JuliaImplicitDiscipline::LoadJuliaDiscipline() {
 
     GCProtect protect_type(type);
 
-    discipline_obj_ = jl_call0(reinterpret_cast<jl_function_t*>(type));
+    discipline_obj_.Set(jl_call0(reinterpret_cast<jl_function_t*>(type)));
     CheckJuliaException();
 
     if (!discipline_obj_) {
         throw std::runtime_error("Failed to instantiate Julia discipline");
     }
-
-    // CRITICAL: Store module and discipline object as global Julia variables
-    // This provides permanent GC rooting that works across all threads
-    jl_module_t* main_module = jl_main_module;
-    jl_set_global(main_module, jl_symbol("_philote_discipline_module"),
-                  reinterpret_cast<jl_value_t*>(module_));
-    jl_set_global(main_module, jl_symbol("_philote_discipline_obj"),
-                  discipline_obj_);
 }
 
 void JuliaImplicitDiscipline::Setup() {
     JuliaThreadGuard guard;
-    GCProtect protect(discipline_obj_);
 
     jl_function_t* setup_fn = GetJuliaFunction("setup!");
     if (!setup_fn) {
         throw std::runtime_error("Julia discipline missing setup!()");
     }
 
-    jl_call1(setup_fn, discipline_obj_);
+    jl_call1(setup_fn, discipline_obj_.get());
     CheckJuliaException();
 
     ExtractIOMetadata();
@@ -74,7 +66,6 @@ void JuliaImplicitDiscipline::ExtractIOMetadata() {
     // Extract inputs and outputs from Julia discipline metadata
     // For brevity, simplified version here
     JuliaThreadGuard guard;
-    GCProtect protect(discipline_obj_);
 
     // TODO: Implement full metadata extraction
     // For now, assume discipline registers its own I/O
@@ -82,11 +73,10 @@ void JuliaImplicitDiscipline::ExtractIOMetadata() {
 
 void JuliaImplicitDiscipline::SetupPartials() {
     JuliaThreadGuard guard;
-    GCProtect protect(discipline_obj_);
 
     jl_function_t* setup_partials_fn = GetJuliaFunction("setup_partials!");
     if (setup_partials_fn) {
-        jl_call1(setup_partials_fn, discipline_obj_);
+        jl_call1(setup_partials_fn, discipline_obj_.get());
         CheckJuliaException();
     }
 
@@ -103,8 +93,9 @@ void JuliaImplicitDiscipline::ComputeResiduals(
     philote::Variables& residuals) {
     JuliaThreadGuard guard;
     std::lock_guard<std::mutex> lock(compute_mutex_);
-
-    GCProtect protect(discipline_obj_);
+    static MethodStats& stats =
+        RequestTelemetry::GetInstance().Method("compute_residuals");
+    TelemetryScope telemetry(stats);
 
     jl_value_t* inputs_dict = VariablesToJuliaDict(inputs);
     jl_value_t* outputs_dict = VariablesToJuliaDict(outputs);
@@ -116,7 +107,7 @@ void JuliaImplicitDiscipline::ComputeResiduals(
     }
 
     jl_value_t** args = new jl_value_t*[3];
-    args[0] = discipline_obj_;
+    args[0] = discipline_obj_.get();
     args[1] = inputs_dict;
     args[2] = outputs_dict;
 
@@ -134,8 +125,9 @@ void JuliaImplicitDiscipline::SolveResiduals(
     philote::Variables& outputs) {
     JuliaThreadGuard guard;
     std::lock_guard<std::mutex> lock(compute_mutex_);
-
-    GCProtect protect(discipline_obj_);
+    static MethodStats& stats =
+        RequestTelemetry::GetInstance().Method("solve_residuals");
+    TelemetryScope telemetry(stats);
 
     jl_value_t* inputs_dict = VariablesToJuliaDict(inputs);
     GCProtect protect_inputs(inputs_dict);
@@ -145,7 +137,7 @@ void JuliaImplicitDiscipline::SolveResiduals(
         throw std::runtime_error("Missing solve_residuals()");
     }
 
-    jl_value_t* result = jl_call2(solve_residuals_fn, discipline_obj_, inputs_dict);
+    jl_value_t* result = jl_call2(solve_residuals_fn, discipline_obj_.get(), inputs_dict);
     CheckJuliaException();
 
     GCProtect protect_result(result);
@@ -158,8 +150,9 @@ void JuliaImplicitDiscipline::ComputeResidualGradients(
     philote::Partials& partials) {
     JuliaThreadGuard guard;
     std::lock_guard<std::mutex> lock(compute_mutex_);
-
-    GCProtect protect(discipline_obj_);
+    static MethodStats& stats =
+        RequestTelemetry::GetInstance().Method("compute_residual_gradients");
+    TelemetryScope telemetry(stats);
 
     jl_value_t* inputs_dict = VariablesToJuliaDict(inputs);
     jl_value_t* outputs_dict = VariablesToJuliaDict(outputs);
@@ -172,7 +165,7 @@ void JuliaImplicitDiscipline::ComputeResidualGradients(
     }
 
     jl_value_t** args = new jl_value_t*[3];
-    args[0] = discipline_obj_;
+    args[0] = discipline_obj_.get();
     args[1] = inputs_dict;
     args[2] = outputs_dict;
 
@@ -188,14 +181,13 @@ void JuliaImplicitDiscipline::ComputeResidualGradients(
 void JuliaImplicitDiscipline::SetOptions(
     const google::protobuf::Struct& options) {
     JuliaThreadGuard guard;
-    GCProtect protect(discipline_obj_);
 
     jl_value_t* options_dict = ProtobufStructToJuliaDict(options);
     GCProtect protect_options(options_dict);
 
     jl_function_t* set_options_fn = GetJuliaFunction("set_options!");
     if (set_options_fn) {
-        jl_call2(set_options_fn, discipline_obj_, options_dict);
+        jl_call2(set_options_fn, discipline_obj_.get(), options_dict);
         CheckJuliaException();
     }
 
@@ -204,7 +196,8 @@ void JuliaImplicitDiscipline::SetOptions(
 
 jl_function_t* JuliaImplicitDiscipline::GetJuliaFunction(
     const std::string& name) {
-    return jl_get_function(module_, name.c_str());
+    // module_ is Main (where LoadJuliaFile includes the discipline)
+    return JuliaRuntime::GetInstance().Handles().MainFunction(name);
 }
 
 }  // namespace julia
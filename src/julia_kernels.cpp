@@ -0,0 +1,67 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_kernels.h"
+
+namespace philote {
+namespace julia {
+
+ArrayConverter::ArrayConverter(const std::vector<size_t>& shape,
+                               ArrayLayout layout, ElementType type)
+    : element_type_(type) {
+    size_ = 1;
+    for (size_t dim : shape) {
+        size_ *= dim;
+    }
+
+    // Column-major data and empty arrays are copied as they are; otherwise
+    // singleton dimensions do not affect element order
+    if (layout == ArrayLayout::kRowMajor && size_ > 0) {
+        size_t rank = std::count_if(shape.begin(), shape.end(),
+                                    [](size_t dim) { return dim != 1; });
+        if (rank > 1) {
+            dims_.reserve(rank);
+            for (size_t dim : shape) {
+                if (dim != 1) {
+                    dims_.push_back(dim);
+                }
+            }
+            reversed_dims_.assign(dims_.rbegin(), dims_.rend());
+        }
+    }
+    Bind();
+}
+
+ArrayConverter ArrayConverter::WithElementType(ElementType type) const {
+    ArrayConverter converter(*this);
+    converter.element_type_ = type;
+    converter.Bind();
+    return converter;
+}
+
+template <typename T>
+ArrayConverter::Kernels ArrayConverter::KernelsFor(size_t rank) {
+    static_assert(kMaxKernelRank == 4, "add the new rank's kernels below");
+    switch (rank) {
+        case 0:
+        case 1:
+            return {&CopyToJulia<T>, &CopyFromJulia<T>};
+        case 2:
+            return {&ToJuliaKernel<2, T>, &FromJuliaKernel<2, T>};
+        case 3:
+            return {&ToJuliaKernel<3, T>, &FromJuliaKernel<3, T>};
+        case 4:
+            return {&ToJuliaKernel<4, T>, &FromJuliaKernel<4, T>};
+        default:
+            return {&ToJuliaGeneric<T>, &FromJuliaGeneric<T>};
+    }
+}
+
+void ArrayConverter::Bind() {
+    kernels_ = element_type_ == ElementType::kFloat32
+                   ? KernelsFor<float>(dims_.size())
+                   : KernelsFor<double>(dims_.size());
+}
+
+}  // namespace julia
+}  // namespace philote
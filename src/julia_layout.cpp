@@ -0,0 +1,228 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_layout.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "julia_kernels.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace philote {
+namespace julia {
+
+namespace {
+
+// A kBlock x kBlock block of both source and destination (2 x 8 KiB) stays
+// in L1 while it is transposed tile by tile
+constexpr size_t kBlock = 32;
+constexpr size_t kTile = 4;
+
+#if !defined(__AVX__) && \
+    (defined(__SSE2__) || defined(_M_X64) || defined(__aarch64__))
+inline void Transpose2x2(const double* src, size_t src_stride, double* dst,
+                         size_t dst_stride) {
+#if defined(__aarch64__)
+    float64x2_t a = vld1q_f64(src);
+    float64x2_t b = vld1q_f64(src + src_stride);
+    vst1q_f64(dst, vzip1q_f64(a, b));
+    vst1q_f64(dst + dst_stride, vzip2q_f64(a, b));
+#else
+    __m128d a = _mm_loadu_pd(src);
+    __m128d b = _mm_loadu_pd(src + src_stride);
+    _mm_storeu_pd(dst, _mm_unpacklo_pd(a, b));
+    _mm_storeu_pd(dst + dst_stride, _mm_unpackhi_pd(a, b));
+#endif
+}
+#endif
+
+// Transpose one full kTile x kTile tile
+inline void Transpose4x4(const double* src, size_t src_stride, double* dst,
+                         size_t dst_stride) {
+#if defined(__AVX__)
+    __m256d r0 = _mm256_loadu_pd(src);
+    __m256d r1 = _mm256_loadu_pd(src + src_stride);
+    __m256d r2 = _mm256_loadu_pd(src + 2 * src_stride);
+    __m256d r3 = _mm256_loadu_pd(src + 3 * src_stride);
+
+    // Interleave row pairs, then swap 128-bit halves into columns
+    __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+    _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(dst + dst_stride, _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(dst + 2 * dst_stride,
+                     _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(dst + 3 * dst_stride,
+                     _mm256_permute2f128_pd(t1, t3, 0x31));
+#elif defined(__SSE2__) || defined(_M_X64) || defined(__aarch64__)
+    Transpose2x2(src, src_stride, dst, dst_stride);
+    Transpose2x2(src + 2, src_stride, dst + 2 * dst_stride, dst_stride);
+    Transpose2x2(src + 2 * src_stride, src_stride, dst + 2, dst_stride);
+    Transpose2x2(src + 2 * src_stride + 2, src_stride, dst + 2 * dst_stride + 2,
+                 dst_stride);
+#else
+    for (size_t i = 0; i < kTile; ++i) {
+        for (size_t j = 0; j < kTile; ++j) {
+            dst[j * dst_stride + i] = src[i * src_stride + j];
+        }
+    }
+#endif
+}
+
+// Scalar transpose for the ragged edges of a block
+inline void TransposeScalar(const double* src, size_t src_stride, double* dst,
+                            size_t dst_stride, size_t rows, size_t cols) {
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            dst[j * dst_stride + i] = src[i * src_stride + j];
+        }
+    }
+}
+
+}  // namespace
+
+void TransposeMatrix(const double* src, size_t src_stride, double* dst,
+                     size_t dst_stride, size_t rows, size_t cols) {
+    for (size_t ib = 0; ib < rows; ib += kBlock) {
+        size_t i_end = std::min(ib + kBlock, rows);
+        for (size_t jb = 0; jb < cols; jb += kBlock) {
+            size_t j_end = std::min(jb + kBlock, cols);
+
+            size_t i = ib;
+            for (; i + kTile <= i_end; i += kTile) {
+                size_t j = jb;
+                for (; j + kTile <= j_end; j += kTile) {
+                    Transpose4x4(src + i * src_stride + j, src_stride,
+                                 dst + j * dst_stride + i, dst_stride);
+                }
+                TransposeScalar(src + i * src_stride + j, src_stride,
+                                dst + j * dst_stride + i, dst_stride, kTile,
+                                j_end - j);
+            }
+            TransposeScalar(src + i * src_stride + jb, src_stride,
+                            dst + jb * dst_stride + i, dst_stride, i_end - i,
+                            j_end - jb);
+        }
+    }
+}
+
+void RowMajorToColumnMajor(const double* src, double* dst,
+                           const std::vector<size_t>& shape) {
+    // Singleton dimensions do not affect element order
+    size_t total_size = 1;
+    size_t rank = 0;
+    size_t leading[2] = {1, 1};
+    for (size_t dim : shape) {
+        total_size *= dim;
+        if (dim != 1) {
+            if (rank < 2) {
+                leading[rank] = dim;
+            }
+            ++rank;
+        }
+    }
+    if (total_size == 0) {
+        return;
+    }
+
+    // The common ranks need no bookkeeping (or allocation)
+    if (rank <= 1) {
+        std::memcpy(dst, src, total_size * sizeof(double));
+        return;
+    }
+    if (rank == 2) {
+        TransposeMatrix(src, leading[1], dst, leading[0], leading[0],
+                        leading[1]);
+        return;
+    }
+
+    std::vector<size_t> dims;
+    dims.reserve(rank);
+    for (size_t dim : shape) {
+        if (dim != 1) {
+            dims.push_back(dim);
+        }
+    }
+
+    ReverseAxes(src, dst, dims);
+}
+
+void ColumnMajorToRowMajor(const double* src, double* dst,
+                           const std::vector<size_t>& shape) {
+    // A column-major array is the row-major array of the reversed shape
+    std::vector<size_t> reversed(shape.rbegin(), shape.rend());
+    RowMajorToColumnMajor(src, dst, reversed);
+}
+
+size_t ColumnMajorToRowMajorIndex(size_t index,
+                                  const std::vector<size_t>& shape) {
+    // Unravel with the first axis fastest, ravel with the last axis fastest
+    std::vector<size_t> subscripts(shape.size());
+    for (size_t k = 0; k < shape.size(); ++k) {
+        subscripts[k] = index % shape[k];
+        index /= shape[k];
+    }
+    size_t row_major = 0;
+    for (size_t k = 0; k < shape.size(); ++k) {
+        row_major = row_major * shape[k] + subscripts[k];
+    }
+    return row_major;
+}
+
+ArrayLayout ParseArrayLayout(const std::string& name) {
+    if (name == "row_major") {
+        return ArrayLayout::kRowMajor;
+    }
+    if (name == "column_major") {
+        return ArrayLayout::kColumnMajor;
+    }
+    throw std::runtime_error("Invalid array layout: " + name +
+                             " (must be 'row_major' or 'column_major')");
+}
+
+const char* ArrayLayoutName(ArrayLayout layout) {
+    return layout == ArrayLayout::kColumnMajor ? "column_major" : "row_major";
+}
+
+const char* ElementTypeName(ElementType type) {
+    return type == ElementType::kFloat32 ? "Float32" : "Float64";
+}
+
+void CopyToJuliaOrder(const double* src, double* dst,
+                      const std::vector<size_t>& shape, ArrayLayout layout) {
+    if (layout == ArrayLayout::kRowMajor) {
+        RowMajorToColumnMajor(src, dst, shape);
+        return;
+    }
+    size_t total_size = 1;
+    for (size_t dim : shape) {
+        total_size *= dim;
+    }
+    if (total_size > 0) {
+        std::memcpy(dst, src, total_size * sizeof(double));
+    }
+}
+
+void CopyFromJuliaOrder(const double* src, double* dst,
+                        const std::vector<size_t>& shape, ArrayLayout layout) {
+    if (layout == ArrayLayout::kRowMajor) {
+        ColumnMajorToRowMajor(src, dst, shape);
+        return;
+    }
+    CopyToJuliaOrder(src, dst, shape, ArrayLayout::kColumnMajor);
+}
+
+}  // namespace julia
+}  // namespace philote
@@ -0,0 +1,73 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_layout_service.h"
+
+#include <map>
+#include <string>
+#include <utility>
+
+namespace philote {
+namespace julia {
+
+namespace {
+
+VariableLayout::Order ToProtoOrder(ArrayLayout layout) {
+    return layout == ArrayLayout::kColumnMajor ? VariableLayout::COLUMN_MAJOR
+                                               : VariableLayout::ROW_MAJOR;
+}
+
+}  // namespace
+
+JuliaLayoutService::JuliaLayoutService(
+    std::shared_ptr<JuliaExplicitDiscipline> discipline)
+    : discipline_(std::move(discipline)) {}
+
+grpc::Status JuliaLayoutService::GetVariableLayouts(
+    grpc::ServerContext* /*context*/, const VariableLayoutsRequest* /*request*/,
+    VariableLayoutsResponse* response) {
+    DescribeVariableLayouts(discipline_->var_meta(),
+                            discipline_->partials_meta(),
+                            discipline_->array_layouts(), response);
+    return grpc::Status::OK;
+}
+
+void DescribeVariableLayouts(const std::vector<philote::VariableMetaData>& vars,
+                             const std::vector<philote::PartialsMetaData>& partials,
+                             const ArrayLayoutMap& layouts,
+                             VariableLayoutsResponse* response) {
+    std::map<std::string, const philote::VariableMetaData*> by_name;
+    for (const auto& meta : vars) {
+        by_name[meta.name()] = &meta;
+
+        VariableLayout* entry = meta.type() == philote::kInput
+                                    ? response->add_inputs()
+                                    : response->add_outputs();
+        entry->set_name(meta.name());
+        for (int64_t dim : meta.shape()) {
+            entry->add_shape(dim);
+        }
+        entry->set_order(ToProtoOrder(layouts.Get(meta.name())));
+    }
+
+    for (const auto& partial : partials) {
+        VariableLayout* entry = response->add_partials();
+        entry->set_name(partial.name());
+        entry->set_subname(partial.subname());
+
+        // Jacobian block shape: output dimensions, then input dimensions
+        for (const std::string& name : {partial.name(), partial.subname()}) {
+            auto it = by_name.find(name);
+            if (it != by_name.end()) {
+                for (int64_t dim : it->second->shape()) {
+                    entry->add_shape(dim);
+                }
+            }
+        }
+        entry->set_order(
+            ToProtoOrder(layouts.GetPartial(partial.name(), partial.subname())));
+    }
+}
+
+}  // namespace julia
+}  // namespace philote
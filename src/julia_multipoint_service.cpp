@@ -0,0 +1,140 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_multipoint_service.h"
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace philote {
+namespace julia {
+
+JuliaMultiPointService::JuliaMultiPointService(
+    std::shared_ptr<JuliaExplicitDiscipline> discipline, size_t max_points)
+    : discipline_(std::move(discipline)), max_points_(max_points) {
+    if (max_points_ < 1) {
+        throw std::runtime_error(
+            "JuliaMultiPointService needs max_points >= 1");
+    }
+}
+
+grpc::Status JuliaMultiPointService::ComputeFunctionMultiPoint(
+    grpc::ServerContext* /*context*/, const MultiPointRequest* request,
+    MultiPointResponse* response) {
+    // Checked before anything is sized by num_points
+    if (request->num_points() > max_points_) {
+        return grpc::Status(
+            grpc::StatusCode::INVALID_ARGUMENT,
+            "num_points " + std::to_string(request->num_points()) +
+                " exceeds the limit of " + std::to_string(max_points_));
+    }
+
+    std::vector<philote::Variables> points;
+    try {
+        points = UnpackMultiPointInputs(*request,
+                                        discipline_->AllocateInputs());
+    } catch (const std::exception& e) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, e.what());
+    }
+
+    try {
+        std::vector<philote::Variables> outputs =
+            discipline_->ComputeMultiPoint(points);
+        PackMultiPointOutputs(outputs, response);
+    } catch (const std::exception& e) {
+        return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+    }
+    return grpc::Status::OK;
+}
+
+std::vector<philote::Variables> UnpackMultiPointInputs(
+    const MultiPointRequest& request, const philote::Variables& templates) {
+    size_t num_points = request.num_points();
+
+    std::map<std::string, const StackedVariable*> stacked;
+    for (const auto& input : request.inputs()) {
+        if (templates.find(input.name()) == templates.end()) {
+            throw std::runtime_error("Unknown input variable: " + input.name());
+        }
+        stacked[input.name()] = &input;
+    }
+
+    // Validate everything before allocating num_points input sets
+    for (const auto& [name, var] : templates) {
+        auto it = stacked.find(name);
+        if (it == stacked.end()) {
+            throw std::runtime_error("Missing input variable: " + name);
+        }
+        const StackedVariable& input = *it->second;
+
+        size_t size = var.Size();
+        if (input.shape_size() > 0) {
+            size_t shape_size = 1;
+            for (int64_t dim : input.shape()) {
+                shape_size *= static_cast<size_t>(dim);
+            }
+            if (shape_size != size) {
+                throw std::runtime_error("Shape of input '" + name +
+                                         "' does not match the discipline");
+            }
+        }
+        if (static_cast<size_t>(input.data_size()) != size * num_points) {
+            throw std::runtime_error(
+                "Input '" + name + "' has " + std::to_string(input.data_size()) +
+                " value(s), expected " + std::to_string(size) + " x " +
+                std::to_string(num_points));
+        }
+    }
+
+    std::vector<philote::Variables> points(num_points, templates);
+    for (const auto& [name, var] : templates) {
+        size_t size = var.Size();
+        const double* data = stacked[name]->data().data();
+        for (size_t j = 0; j < num_points; ++j) {
+            philote::Variable& point_var = points[j][name];
+            for (size_t i = 0; i < size; ++i) {
+                point_var(i) = data[j * size + i];
+            }
+        }
+    }
+
+    return points;
+}
+
+void PackMultiPointOutputs(const std::vector<philote::Variables>& outputs,
+                           MultiPointResponse* response) {
+    response->set_num_points(outputs.size());
+    if (outputs.empty()) {
+        return;
+    }
+
+    size_t num_points = outputs.size();
+    for (const auto& [name, first] : outputs[0]) {
+        size_t size = first.Size();
+
+        StackedVariable* output = response->add_outputs();
+        output->set_name(name);
+        for (size_t dim : first.Shape()) {
+            output->add_shape(static_cast<int64_t>(dim));
+        }
+
+        auto* data = output->mutable_data();
+        data->Reserve(static_cast<int>(size * num_points));
+        for (size_t j = 0; j < num_points; ++j) {
+            auto it = outputs[j].find(name);
+            if (it == outputs[j].end() || it->second.Size() != size) {
+                throw std::runtime_error(
+                    "Output '" + name + "' is missing or has a different size "
+                    "at point " + std::to_string(j));
+            }
+            for (size_t i = 0; i < size; ++i) {
+                data->Add(it->second(i));
+            }
+        }
+    }
+}
+
+}  // namespace julia
+}  // namespace philote
@@ -0,0 +1,87 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_packed.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace philote {
+namespace julia {
+
+PackedIndex MakePackedIndex(const std::vector<philote::VariableMetaData>& vars,
+                            philote::VariableType type,
+                            const ArrayLayoutMap& layouts) {
+    PackedIndex index;
+    for (const auto& meta : vars) {
+        if (meta.type() != type) {
+            continue;
+        }
+        PackedSlot slot;
+        slot.name = meta.name();
+        slot.shape.assign(meta.shape().begin(), meta.shape().end());
+        slot.size = 1;
+        for (size_t dim : slot.shape) {
+            slot.size *= dim;
+        }
+        slot.layout = layouts.Get(meta.name());
+        slot.converter = ArrayConverter(slot.shape, slot.layout);
+        index.slots.push_back(std::move(slot));
+    }
+
+    std::sort(index.slots.begin(), index.slots.end(),
+              [](const PackedSlot& a, const PackedSlot& b) {
+                  return a.name < b.name;
+              });
+    for (PackedSlot& slot : index.slots) {
+        slot.offset = index.size;
+        index.size += slot.size;
+    }
+    return index;
+}
+
+void PackVariables(const philote::Variables& vars, const PackedIndex& index,
+                   double* buffer) {
+    // Both are sorted by name, so they are walked in step
+    auto var = vars.begin();
+    for (const PackedSlot& slot : index.slots) {
+        if (var == vars.end() || var->first != slot.name) {
+            throw std::runtime_error("Missing variable for packed buffer: " +
+                                     slot.name);
+        }
+        if (var->second.Size() != slot.size) {
+            throw std::runtime_error(
+                "Variable '" + slot.name + "' has " +
+                std::to_string(var->second.Size()) + " value(s), expected " +
+                std::to_string(slot.size));
+        }
+        if (slot.size > 0) {
+            const double* data =
+                &const_cast<philote::Variable&>(var->second)(0);
+            slot.converter.ToJulia(data, buffer + slot.offset);
+        }
+        ++var;
+    }
+    if (var != vars.end()) {
+        throw std::runtime_error("Unknown variable for packed buffer: " +
+                                 var->first);
+    }
+}
+
+philote::Variables UnpackVariables(const double* buffer,
+                                   const PackedIndex& index) {
+    philote::Variables vars;
+    for (const PackedSlot& slot : index.slots) {
+        philote::Variable& var =
+            vars.emplace_hint(vars.end(), slot.name,
+                              philote::Variable(philote::kOutput, slot.shape))
+                ->second;
+        if (slot.size > 0) {
+            slot.converter.FromJulia(buffer + slot.offset, &var(0));
+        }
+    }
+    return vars;
+}
+
+}  // namespace julia
+}  // namespace philote
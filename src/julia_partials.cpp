@@ -0,0 +1,67 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_partials.h"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+namespace philote {
+namespace julia {
+
+PartialsBlockTable MakePartialsBlockTable(
+    const std::vector<philote::VariableMetaData>& vars,
+    const std::vector<philote::PartialsMetaData>& partials,
+    const ArrayLayoutMap& layouts, const SparsityPatterns& patterns) {
+    std::map<std::string, const philote::VariableMetaData*> by_name;
+    for (const auto& meta : vars) {
+        by_name[meta.name()] = &meta;
+    }
+
+    PartialsBlockTable table;
+    table.reserve(partials.size());
+    for (const auto& partial : partials) {
+        PartialsBlock block;
+        block.key = {partial.name(), partial.subname()};
+
+        for (const std::string& name : {partial.name(), partial.subname()}) {
+            auto it = by_name.find(name);
+            if (it == by_name.end()) {
+                throw std::runtime_error("Partial d" + partial.name() + "/d" +
+                                         partial.subname() +
+                                         " refers to unknown variable " + name);
+            }
+            for (int64_t dim : it->second->shape()) {
+                block.shape.push_back(static_cast<size_t>(dim));
+            }
+        }
+        block.size = 1;
+        for (size_t dim : block.shape) {
+            block.size *= dim;
+        }
+        block.layout = layouts.GetPartial(partial.name(), partial.subname());
+
+        auto pattern = patterns.find(block.key);
+        if (pattern != patterns.end()) {
+            block.pattern = pattern->second;
+        } else {
+            block.converter = ArrayConverter(block.shape, block.layout);
+        }
+        table.push_back(std::move(block));
+    }
+
+    auto by_key = [](const PartialsBlock& a, const PartialsBlock& b) {
+        return a.key < b.key;
+    };
+    std::stable_sort(table.begin(), table.end(), by_key);
+    table.erase(std::unique(table.begin(), table.end(),
+                            [](const PartialsBlock& a, const PartialsBlock& b) {
+                                return a.key == b.key;
+                            }),
+                table.end());
+    return table;
+}
+
+}  // namespace julia
+}  // namespace philote
@@ -0,0 +1,115 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_roots.h"
+
+#include <stdexcept>
+
+#include "julia_gc.h"
+#include "julia_runtime.h"
+
+namespace philote {
+namespace julia {
+
+// No Julia allocation happens while mutex_ is held: a thread blocked on it
+// is in GC-unsafe state, so a collection triggered under the lock could
+// never stop the world
+void JuliaRootPool::Initialize() {
+    GCFrame<1> frame;
+    jl_array_t* root = frame.Set(0, jl_alloc_vec_any(kMaxChunks));
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (root_) {
+            return;
+        }
+        root_ = root;
+    }
+    // Rooted by the frame until the global holds it
+    jl_set_global(jl_main_module, jl_symbol("_philote_root_pool"),
+                  reinterpret_cast<jl_value_t*>(root));
+}
+
+size_t JuliaRootPool::Acquire(jl_value_t* obj) {
+    GCFrame<1> frame;  // Roots a chunk allocated outside the lock
+    jl_array_t* spare = nullptr;
+    size_t slot;
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!root_) {
+                throw std::runtime_error("Julia root pool is not initialized");
+            }
+            if (!free_.empty()) {
+                slot = free_.back();
+                free_.pop_back();
+                break;
+            }
+            if (next_ < num_chunks_ * kChunkSlots) {
+                slot = next_++;
+                break;
+            }
+            if (num_chunks_ == kMaxChunks) {
+                throw std::runtime_error("Julia root pool is full");
+            }
+            if (spare) {
+                // Storing into root_ only runs a write barrier
+                jl_array_ptr_set(root_, num_chunks_,
+                                 reinterpret_cast<jl_value_t*>(spare));
+                chunks_[num_chunks_].store(spare, std::memory_order_release);
+                ++num_chunks_;
+                slot = next_++;
+                break;
+            }
+        }
+        // Full: allocate a chunk unlocked and retry, in case another thread
+        // grew the pool meanwhile (its spare is then just garbage)
+        spare = frame.Set(0, jl_alloc_vec_any(kChunkSlots));
+    }
+    if (obj) {
+        Set(slot, obj);
+    }
+    return slot;
+}
+
+void JuliaRootPool::Release(size_t slot) {
+    if (slot == kNoSlot) {
+        return;
+    }
+    // Storing null needs no write barrier, so any thread may release
+    Data(slot)[slot % kChunkSlots] = nullptr;
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(slot);  // Allocates C++ memory only
+}
+
+size_t JuliaRootPool::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return next_ - free_.size();
+}
+
+JuliaRoot::JuliaRoot(jl_value_t* obj)
+    : slot_(JuliaRuntime::GetInstance().Roots().Acquire(obj)) {}
+
+jl_value_t* JuliaRoot::get() const {
+    return slot_ == JuliaRootPool::kNoSlot
+               ? nullptr
+               : JuliaRuntime::GetInstance().Roots().Get(slot_);
+}
+
+void JuliaRoot::Set(jl_value_t* obj) {
+    JuliaRootPool& pool = JuliaRuntime::GetInstance().Roots();
+    if (slot_ == JuliaRootPool::kNoSlot) {
+        slot_ = pool.Acquire(obj);
+    } else {
+        pool.Set(slot_, obj);
+    }
+}
+
+void JuliaRoot::Reset() {
+    if (slot_ != JuliaRootPool::kNoSlot) {
+        JuliaRuntime::GetInstance().Roots().Release(slot_);
+        slot_ = JuliaRootPool::kNoSlot;
+    }
+}
+
+}  // namespace julia
+}  // namespace philote
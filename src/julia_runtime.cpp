@@ -3,22 +3,84 @@
 
 #include "julia_runtime.h"
 
+#include <dlfcn.h>
+#include <stdlib.h>
+
 #include <filesystem>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 
 namespace philote {
 namespace julia {
 
+namespace {
+
+// libjulia's sibling bin directory, which jl_init() derives the same way;
+// jl_init_with_image() needs it to locate the standard library
+std::string JuliaBinDir() {
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void*>(&jl_init), &info) == 0 ||
+        !info.dli_fname) {
+        return "";
+    }
+    std::filesystem::path libdir =
+        std::filesystem::path(info.dli_fname).parent_path();
+    return (libdir / ".." / "bin").string();
+}
+
+}  // namespace
+
 std::once_flag JuliaRuntime::init_flag_;
+JuliaRuntimeOptions JuliaRuntime::options_;
+std::atomic<bool> JuliaRuntime::constructed_{false};
+
+void JuliaRuntime::Configure(const JuliaRuntimeOptions& options) {
+    if (constructed_.load()) {
+        throw std::runtime_error(
+            "JuliaRuntime::Configure must be called before GetInstance");
+    }
+    if (options.num_threads < 1) {
+        throw std::runtime_error("num_threads must be >= 1");
+    }
+    // Julia aborts the process on a missing image, so fail while we can
+    if (!options.sysimage.empty() &&
+        !std::filesystem::exists(options.sysimage)) {
+        throw std::runtime_error("Julia sysimage does not exist: " +
+                                 options.sysimage);
+    }
+    options_ = options;
+}
 
 JuliaRuntime::JuliaRuntime() {
-    std::call_once(init_flag_, []() {
-        jl_init();
+    constructed_.store(true);
+    std::call_once(init_flag_, [this]() {
+        // Julia reads its thread count from the environment during jl_init().
+        // Executor workers are adopted foreign threads, so these only serve
+        // disciplines that spawn tasks of their own
+        if (options_.num_threads > 1) {
+            setenv("JULIA_NUM_THREADS",
+                   std::to_string(options_.num_threads).c_str(), 1);
+        }
+
+        if (options_.sysimage.empty()) {
+            jl_init();
+        } else {
+            // A prebuilt image holding the discipline's packages and their
+            // compiled code, so loading and the first calls skip the JIT
+            std::string abs_image =
+                std::filesystem::absolute(options_.sysimage).string();
+            std::string bindir = JuliaBinDir();
+            jl_init_with_image(bindir.empty() ? nullptr : bindir.c_str(),
+                               abs_image.c_str());
+        }
 
         // Prevent BLAS from spawning extra threads
         // This avoids thread explosion when Julia does linear algebra
         jl_eval_string("using LinearAlgebra; BLAS.set_num_threads(1)");
+
+        handles_.Populate();
+        roots_.Initialize();
     });
     initialized_.store(true);
 }
@@ -47,18 +109,34 @@ jl_module_t* JuliaRuntime::LoadJuliaFile(const std::string& filepath) {
     std::cout << "[DEBUG] Loading Julia file: " << filepath << std::endl;
     std::cout << "[DEBUG] Absolute path: " << abs_path_str << std::endl;
 
+    // A sysimage built by philote_julia_add_sysimage already holds the file
+    // and its compiled code; including it again would redefine its methods
+    // and throw that code away
+    std::string baked_cmd =
+        "isdefined(Main, :PhiloteSysimage) && Main.PhiloteSysimage.baked(\"" +
+        abs_path_str + "\")";
+    jl_value_t* baked = jl_eval_string(baked_cmd.c_str());
+    if (!jl_exception_occurred() && baked && jl_is_bool(baked) &&
+        jl_unbox_bool(baked)) {
+        return jl_main_module;
+    }
+    jl_exception_clear();
+
     // Use jl_eval_string with include() - this gives better error messages
     std::string include_cmd = "include(\"" + abs_path_str + "\")";
     std::cout << "[DEBUG] Eval string: " << include_cmd << std::endl;
 
     jl_value_t* result = jl_eval_string(include_cmd.c_str());
 
+    // The file may (re)define functions we have memoized
+    handles_.InvalidateMainFunctions();
+
     // Check for exceptions
     if (jl_exception_occurred()) {
         jl_value_t* ex = jl_exception_occurred();
 
         // Print full error to stderr using Julia's showerror
-        jl_function_t* showerror_fn = jl_get_function(jl_base_module, "showerror");
+        jl_function_t* showerror_fn = handles_.showerror_fn;
         if (showerror_fn) {
             std::cerr << "\n[Julia Error] Loading file " << filepath << ":\n";
             std::cerr.flush();
@@ -68,7 +146,7 @@ jl_module_t* JuliaRuntime::LoadJuliaFile(const std::string& filepath) {
         }
 
         // Also get full error message using sprint(showerror)
-        jl_function_t* sprint_fn = jl_get_function(jl_base_module, "sprint");
+        jl_function_t* sprint_fn = handles_.sprint_fn;
         std::string detailed_msg;
         if (sprint_fn && showerror_fn) {
             // Clear exception before calling sprint
@@ -96,6 +174,7 @@ jl_value_t* JuliaRuntime::EvalString(const std::string& code) {
     }
 
     jl_value_t* result = jl_eval_string(code.c_str());
+    handles_.InvalidateMainFunctions();
 
     // Check for exceptions
     if (jl_exception_occurred()) {
@@ -0,0 +1,86 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_sparse.h"
+
+#include <stdexcept>
+
+namespace philote {
+namespace julia {
+
+namespace {
+
+size_t Product(const std::vector<size_t>& shape) {
+    size_t size = 1;
+    for (size_t dim : shape) {
+        size *= dim;
+    }
+    return size;
+}
+
+// 0-based offset of a 1-based Julia linear index in the given layout
+size_t ToOffset(int64_t index, const std::vector<size_t>& shape, size_t size,
+                ArrayLayout layout, const char* what) {
+    if (index < 1 || static_cast<size_t>(index) > size) {
+        throw std::runtime_error(std::string("Sparsity pattern ") + what +
+                                 " index " + std::to_string(index) +
+                                 " out of range 1:" + std::to_string(size));
+    }
+    size_t offset = static_cast<size_t>(index - 1);
+    return layout == ArrayLayout::kColumnMajor
+               ? offset
+               : ColumnMajorToRowMajorIndex(offset, shape);
+}
+
+}  // namespace
+
+SparsityPattern MakeSparsityPattern(const int64_t* rows, const int64_t* cols,
+                                    size_t nnz,
+                                    const std::vector<size_t>& output_shape,
+                                    const std::vector<size_t>& input_shape,
+                                    ArrayLayout layout) {
+    SparsityPattern pattern;
+    pattern.shape = output_shape;
+    pattern.shape.insert(pattern.shape.end(), input_shape.begin(),
+                         input_shape.end());
+    pattern.output_size = Product(output_shape);
+    pattern.input_size = Product(input_shape);
+    pattern.layout = layout;
+
+    pattern.rows.resize(nnz);
+    pattern.cols.resize(nnz);
+    for (size_t k = 0; k < nnz; ++k) {
+        pattern.rows[k] = ToOffset(rows[k], output_shape, pattern.output_size,
+                                   layout, "row");
+        pattern.cols[k] = ToOffset(cols[k], input_shape, pattern.input_size,
+                                   layout, "column");
+    }
+    return pattern;
+}
+
+philote::Variable DensifyPartial(const SparsePartial& partial) {
+    const SparsityPattern& pattern = *partial.pattern;
+    if (partial.values.size() != pattern.nnz()) {
+        throw std::runtime_error(
+            "Sparse partial has " + std::to_string(partial.values.size()) +
+            " value(s), pattern has " + std::to_string(pattern.nnz()));
+    }
+
+    philote::Variable dense(philote::kOutput, pattern.shape);
+    for (size_t i = 0; i < dense.Size(); ++i) {
+        dense(i) = 0.0;
+    }
+
+    // Duplicate entries accumulate, as in a COO matrix
+    bool row_major = pattern.layout == ArrayLayout::kRowMajor;
+    for (size_t k = 0; k < pattern.nnz(); ++k) {
+        size_t offset = row_major
+                            ? pattern.rows[k] * pattern.input_size + pattern.cols[k]
+                            : pattern.rows[k] + pattern.cols[k] * pattern.output_size;
+        dense(offset) += partial.values[k];
+    }
+    return dense;
+}
+
+}  // namespace julia
+}  // namespace philote
@@ -0,0 +1,108 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_sparse_service.h"
+
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace philote {
+namespace julia {
+
+JuliaSparseGradientService::JuliaSparseGradientService(
+    std::shared_ptr<JuliaExplicitDiscipline> discipline)
+    : discipline_(std::move(discipline)) {}
+
+grpc::Status JuliaSparseGradientService::ComputeGradientSparse(
+    grpc::ServerContext* /*context*/, const SparseGradientRequest* request,
+    SparseGradientResponse* response) {
+    philote::Variables inputs;
+    try {
+        inputs = UnpackSparseGradientInputs(*request,
+                                            discipline_->AllocateInputs());
+    } catch (const std::exception& e) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, e.what());
+    }
+
+    try {
+        philote::Partials dense;
+        SparsePartials sparse;
+        discipline_->ComputeSparsePartials(inputs, dense, sparse);
+        PackSparseGradient(dense, sparse, response);
+    } catch (const std::exception& e) {
+        return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+    }
+    return grpc::Status::OK;
+}
+
+philote::Variables UnpackSparseGradientInputs(
+    const SparseGradientRequest& request, const philote::Variables& templates) {
+    philote::Variables inputs = templates;
+    std::set<std::string> seen;
+
+    for (const auto& input : request.inputs()) {
+        auto it = inputs.find(input.name());
+        if (it == inputs.end()) {
+            throw std::runtime_error("Unknown input variable: " + input.name());
+        }
+        philote::Variable& var = it->second;
+        if (static_cast<size_t>(input.data_size()) != var.Size()) {
+            throw std::runtime_error(
+                "Input '" + input.name() + "' has " +
+                std::to_string(input.data_size()) + " value(s), expected " +
+                std::to_string(var.Size()));
+        }
+        for (size_t i = 0; i < var.Size(); ++i) {
+            var(i) = input.data(static_cast<int>(i));
+        }
+        seen.insert(input.name());
+    }
+
+    for (const auto& [name, var] : templates) {
+        if (!seen.count(name)) {
+            throw std::runtime_error("Missing input variable: " + name);
+        }
+    }
+    return inputs;
+}
+
+void PackSparseGradient(const philote::Partials& dense,
+                        const SparsePartials& sparse,
+                        SparseGradientResponse* response) {
+    for (const auto& [key, var] : dense) {
+        JacobianBlock* block = response->add_partials();
+        block->set_name(key.first);
+        block->set_subname(key.second);
+        for (size_t dim : var.Shape()) {
+            block->add_shape(static_cast<int64_t>(dim));
+        }
+        auto* values = block->mutable_values();
+        values->Reserve(static_cast<int>(var.Size()));
+        for (size_t i = 0; i < var.Size(); ++i) {
+            values->Add(var(i));
+        }
+    }
+
+    for (const auto& [key, partial] : sparse) {
+        const SparsityPattern& pattern = *partial.pattern;
+        JacobianBlock* block = response->add_partials();
+        block->set_name(key.first);
+        block->set_subname(key.second);
+        for (size_t dim : pattern.shape) {
+            block->add_shape(static_cast<int64_t>(dim));
+        }
+        block->mutable_rows()->Reserve(static_cast<int>(pattern.nnz()));
+        block->mutable_cols()->Reserve(static_cast<int>(pattern.nnz()));
+        for (size_t k = 0; k < pattern.nnz(); ++k) {
+            block->add_rows(static_cast<int64_t>(pattern.rows[k]));
+            block->add_cols(static_cast<int64_t>(pattern.cols[k]));
+        }
+        block->mutable_values()->Add(partial.values.begin(),
+                                     partial.values.end());
+    }
+}
+
+}  // namespace julia
+}  // namespace philote
@@ -0,0 +1,240 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_telemetry.h"
+
+#include <julia.h>
+#include <julia_gcext.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <utility>
+
+// Exported by libjulia (Base.cumulative_compile_time_ns and
+// Base.cumulative_compile_timing) but not declared in julia.h
+extern "C" uint64_t jl_cumulative_compile_time_ns(void);
+extern "C" void jl_cumulative_compile_timing_enable(void);
+
+namespace philote {
+namespace julia {
+
+namespace {
+
+// Collections completed, counted from the first scope
+std::atomic<uint64_t> collections_completed{0};
+
+// Open scopes on this thread; only the outermost one records
+thread_local int scope_depth = 0;
+
+// Outermost scopes open in the process (low 32 bits) and started so far
+// (high 32 bits), in one word so a scope sees every other that overlaps it:
+// those open when it starts, or started before it ends
+std::atomic<uint64_t> scope_state{0};
+constexpr uint64_t kScopeOpen = 1;
+constexpr uint64_t kScopeStarted = uint64_t{1} << 32;
+constexpr uint64_t kOpenMask = kScopeStarted - 1;
+
+// Runs on the thread that triggered the collection, once it finished
+void CountCompletedCollection(int /*full*/) {
+    collections_completed.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Start the Julia counters the scopes read (once per process)
+void EnableJuliaCounters() {
+    static std::once_flag flag;
+    std::call_once(flag, []() {
+        jl_cumulative_compile_timing_enable();
+        jl_gc_set_cb_post_gc(&CountCompletedCollection, 1);
+    });
+}
+
+uint64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+RequestSample ReadCounters() {
+    RequestSample now;
+    now.wall_ns = NowNs();
+    now.allocated_bytes = static_cast<uint64_t>(jl_gc_total_bytes());
+    now.gc_pause_ns = jl_gc_total_hrtime();
+    now.compile_ns = jl_cumulative_compile_time_ns();
+    now.collections = collections_completed.load(std::memory_order_relaxed);
+    return now;
+}
+
+// Counter difference; the byte count can dip when Julia folds a thread's
+// allocation counter into the global one mid-request
+uint64_t Delta(uint64_t end, uint64_t start) {
+    return end > start ? end - start : 0;
+}
+
+}  // namespace
+
+uint64_t HistogramSnapshot::Quantile(double q) const {
+    if (count == 0) {
+        return 0;
+    }
+    q = std::clamp(q, 0.0, 1.0);
+    uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(q * static_cast<double>(count) + 0.5));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return i == 0 ? 0 : std::min(UpperBound(i), max);
+        }
+    }
+    return max;
+}
+
+void Histogram::Record(uint64_t value) {
+    buckets_[std::bit_width(value)].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+    uint64_t max = max_.load(std::memory_order_relaxed);
+    while (value > max &&
+           !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+}
+
+HistogramSnapshot Histogram::Snapshot() const {
+    // The count is summed from the buckets so quantiles stay consistent
+    // with them while other threads record
+    HistogramSnapshot snapshot;
+    for (size_t i = 0; i < HistogramSnapshot::kBuckets; ++i) {
+        snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+        snapshot.count += snapshot.buckets[i];
+    }
+    snapshot.sum = sum_.load(std::memory_order_relaxed);
+    snapshot.max = max_.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void Histogram::Reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+void MethodStats::Record(const RequestSample& sample) {
+    wall_ns.Record(sample.wall_ns);
+    gc_pause_ns.Record(sample.gc_pause_ns);
+    if (sample.collections > 0) {
+        collections.fetch_add(sample.collections, std::memory_order_relaxed);
+        calls_with_gc.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (sample.overlapped) {
+        calls_overlapped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    allocated_bytes.Record(sample.allocated_bytes);
+    compile_ns.Record(sample.compile_ns);
+    if (sample.compile_ns > 0) {
+        calls_compiling.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void MethodStats::Reset() {
+    wall_ns.Reset();
+    allocated_bytes.Reset();
+    gc_pause_ns.Reset();
+    compile_ns.Reset();
+    collections.store(0, std::memory_order_relaxed);
+    calls_with_gc.store(0, std::memory_order_relaxed);
+    calls_compiling.store(0, std::memory_order_relaxed);
+    calls_overlapped.store(0, std::memory_order_relaxed);
+}
+
+RequestTelemetry& RequestTelemetry::GetInstance() {
+    static RequestTelemetry instance;
+    return instance;
+}
+
+MethodStats& RequestTelemetry::Method(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = methods_.find(name);
+    if (it == methods_.end()) {
+        it = methods_.emplace(std::string(name),
+                              std::make_unique<MethodStats>()).first;
+    }
+    return *it->second;
+}
+
+std::vector<MethodTelemetry> RequestTelemetry::Snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<MethodTelemetry> result;
+    result.reserve(methods_.size());
+    for (const auto& [name, stats] : methods_) {
+        MethodTelemetry entry;
+        entry.method = name;
+        entry.wall_ns = stats->wall_ns.Snapshot();
+        entry.allocated_bytes = stats->allocated_bytes.Snapshot();
+        entry.gc_pause_ns = stats->gc_pause_ns.Snapshot();
+        entry.compile_ns = stats->compile_ns.Snapshot();
+        entry.collections = stats->collections.load(std::memory_order_relaxed);
+        entry.calls_with_gc =
+            stats->calls_with_gc.load(std::memory_order_relaxed);
+        entry.calls_compiling =
+            stats->calls_compiling.load(std::memory_order_relaxed);
+        entry.calls_overlapped =
+            stats->calls_overlapped.load(std::memory_order_relaxed);
+        result.push_back(std::move(entry));
+    }
+    return result;
+}
+
+void RequestTelemetry::Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [name, stats] : methods_) {
+        stats->Reset();
+    }
+}
+
+TelemetryScope::TelemetryScope(MethodStats& stats) {
+    if (scope_depth++ > 0) {
+        return;
+    }
+    Begin(stats);
+}
+
+TelemetryScope::TelemetryScope(const char* method) {
+    if (scope_depth++ > 0) {
+        return;
+    }
+    Begin(RequestTelemetry::GetInstance().Method(method));
+}
+
+void TelemetryScope::Begin(MethodStats& stats) {
+    EnableJuliaCounters();
+    stats_ = &stats;
+    uint64_t prev = scope_state.fetch_add(kScopeStarted + kScopeOpen);
+    generation_ = ((prev >> 32) + 1) & kOpenMask;
+    start_ = ReadCounters();
+    start_.overlapped = (prev & kOpenMask) != 0;
+}
+
+TelemetryScope::~TelemetryScope() {
+    --scope_depth;
+    if (!stats_) {
+        return;
+    }
+    RequestSample end = ReadCounters();
+    RequestSample sample;
+    sample.wall_ns = Delta(end.wall_ns, start_.wall_ns);
+    sample.allocated_bytes =
+        Delta(end.allocated_bytes, start_.allocated_bytes);
+    sample.gc_pause_ns = Delta(end.gc_pause_ns, start_.gc_pause_ns);
+    sample.compile_ns = Delta(end.compile_ns, start_.compile_ns);
+    sample.collections = Delta(end.collections, start_.collections);
+    // Another scope started after this one if the generation moved on
+    uint64_t prev = scope_state.fetch_sub(kScopeOpen);
+    sample.overlapped = start_.overlapped || (prev >> 32) != generation_;
+    stats_->Record(sample);
+}
+
+}  // namespace julia
+}  // namespace philote
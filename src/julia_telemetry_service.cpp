@@ -0,0 +1,60 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include "julia_telemetry_service.h"
+
+namespace philote {
+namespace julia {
+
+namespace {
+
+void DescribeHistogram(const HistogramSnapshot& snapshot,
+                       TelemetryHistogram* histogram) {
+    histogram->set_count(snapshot.count);
+    histogram->set_sum(snapshot.sum);
+    histogram->set_max(snapshot.max);
+    histogram->set_p50(snapshot.Quantile(0.50));
+    histogram->set_p90(snapshot.Quantile(0.90));
+    histogram->set_p99(snapshot.Quantile(0.99));
+    for (size_t i = 0; i < HistogramSnapshot::kBuckets; ++i) {
+        if (snapshot.buckets[i] == 0) {
+            continue;
+        }
+        TelemetryHistogram::Bucket* bucket = histogram->add_buckets();
+        bucket->set_upper_bound(HistogramSnapshot::UpperBound(i));
+        bucket->set_count(snapshot.buckets[i]);
+    }
+}
+
+}  // namespace
+
+grpc::Status JuliaTelemetryService::GetRequestTelemetry(
+    grpc::ServerContext* /*context*/, const RequestTelemetryRequest* request,
+    RequestTelemetryResponse* response) {
+    RequestTelemetry& telemetry = RequestTelemetry::GetInstance();
+    DescribeRequestTelemetry(telemetry.Snapshot(), response);
+    if (request->reset()) {
+        telemetry.Reset();
+    }
+    return grpc::Status::OK;
+}
+
+void DescribeRequestTelemetry(const std::vector<MethodTelemetry>& methods,
+                              RequestTelemetryResponse* response) {
+    for (const MethodTelemetry& method : methods) {
+        MethodRequestTelemetry* entry = response->add_methods();
+        entry->set_method(method.method);
+        DescribeHistogram(method.wall_ns, entry->mutable_wall_time_ns());
+        DescribeHistogram(method.allocated_bytes,
+                          entry->mutable_allocated_bytes());
+        DescribeHistogram(method.gc_pause_ns, entry->mutable_gc_pause_ns());
+        DescribeHistogram(method.compile_ns, entry->mutable_compile_time_ns());
+        entry->set_collections(method.collections);
+        entry->set_calls_with_gc(method.calls_with_gc);
+        entry->set_calls_compiling(method.calls_compiling);
+        entry->set_calls_overlapped(method.calls_overlapped);
+    }
+}
+
+}  // namespace julia
+}  // namespace philote
@@ -4,20 +4,31 @@
 #include <grpc++/resource_quota.h>
 #include <grpc++/server_builder.h>
 
+#include <chrono>
 #include <csignal>
 #include <iostream>
 #include <memory>
 
+#include "julia_async_server.h"
 #include "julia_config.h"
 #include "julia_executor.h"
 #include "julia_explicit_discipline.h"
 #include "julia_implicit_discipline.h"
+#include "julia_layout_service.h"
+#include "julia_multipoint_service.h"
 #include "julia_runtime.h"
+#include "julia_sparse_service.h"
+#include "julia_telemetry_service.h"
 
 using philote::Discipline;
+using philote::julia::JuliaAsyncServer;
 using philote::julia::JuliaExplicitDiscipline;
 using philote::julia::JuliaImplicitDiscipline;
+using philote::julia::JuliaLayoutService;
+using philote::julia::JuliaMultiPointService;
 using philote::julia::JuliaRuntime;
+using philote::julia::JuliaSparseGradientService;
+using philote::julia::JuliaTelemetryService;
 using philote::julia::PhiloteConfig;
 
 // Global server pointer for signal handler
@@ -51,17 +62,49 @@ int main(int argc, char** argv) {
         std::cout << "  Discipline kind: " << config.discipline.kind << std::endl;
         std::cout << "  Julia file: " << config.discipline.julia_file << std::endl;
         std::cout << "  Julia type: " << config.discipline.julia_type << std::endl;
+        if (!config.discipline.sysimage.empty()) {
+            std::cout << "  Julia sysimage: " << config.discipline.sysimage
+                      << std::endl;
+        }
         std::cout << "  Server address: " << config.server.address << std::endl;
         std::cout << "  Max threads: " << config.server.max_threads << std::endl;
+        std::cout << "  Executor mode: " << config.server.executor_mode
+                  << " (" << config.server.executor_workers << " worker(s))"
+                  << std::endl;
+        std::cout << "  Server mode: " << config.server.server_mode;
+        if (config.server.server_mode == "async") {
+            std::cout << " (" << config.server.cq_threads
+                      << " completion-queue thread(s))";
+        }
+        std::cout << std::endl;
 
-        // 2. Initialize Julia runtime and single-threaded executor
+        // 2. Initialize Julia runtime and executor
         std::cout << "\nInitializing Julia runtime..." << std::endl;
+        philote::julia::JuliaRuntimeOptions runtime_options;
+        runtime_options.num_threads = config.server.julia_threads;
+        runtime_options.sysimage = config.discipline.sysimage;
+        JuliaRuntime::Configure(runtime_options);
         JuliaRuntime::GetInstance();
         std::cout << "Julia runtime initialized successfully." << std::endl;
 
-        std::cout << "Starting Julia executor thread..." << std::endl;
-        philote::julia::JuliaExecutor::GetInstance().Start();
-        std::cout << "Julia executor started (ALL Julia calls on single thread)." << std::endl;
+        std::cout << "Starting Julia executor..." << std::endl;
+        philote::julia::GCPolicy gc_policy;
+        gc_policy.defer_in_tasks = config.server.gc_defer_in_tasks;
+        gc_policy.idle_interval =
+            std::chrono::milliseconds(config.server.gc_idle_ms);
+        gc_policy.full_threshold_bytes =
+            static_cast<size_t>(config.server.gc_full_threshold_mb) << 20;
+        philote::julia::JuliaExecutor::GetInstance().SetGCPolicy(gc_policy);
+        philote::julia::JuliaExecutor::GetInstance().Start(
+            config.server.executor_workers);
+        if (config.server.executor_mode == "parallel") {
+            std::cout << "Julia executor started ("
+                      << config.server.executor_workers
+                      << " workers; thread-safe disciplines run concurrently)."
+                      << std::endl;
+        } else {
+            std::cout << "Julia executor started (ALL Julia calls on single thread)." << std::endl;
+        }
 
         // 3. Create discipline wrapper and build server
         std::cout << "\nLoading Julia discipline..." << std::endl;
@@ -75,17 +118,49 @@ int main(int argc, char** argv) {
                                 grpc::InsecureServerCredentials());
 
         // Allow gRPC to use multiple threads for network I/O
-        // Julia calls are serialized via JuliaExecutor (single-threaded)
+        // Julia calls are dispatched to JuliaExecutor workers
         grpc::ResourceQuota quota;
         quota.SetMaxThreads(config.server.max_threads);
         builder.SetResourceQuota(quota);
 
         // Create discipline and register services
         // Note: We need to keep the discipline alive, so use shared_ptr
-        if (config.discipline.kind == "explicit") {
+        std::unique_ptr<JuliaAsyncServer> async_server;
+        std::unique_ptr<JuliaMultiPointService> multipoint_service;
+        std::unique_ptr<JuliaLayoutService> layout_service;
+        std::unique_ptr<JuliaSparseGradientService> sparse_service;
+        // Per-method request telemetry, whatever the discipline kind
+        JuliaTelemetryService telemetry_service;
+        builder.RegisterService(&telemetry_service);
+        if (config.server.server_mode == "async") {
+            // Compute RPCs served from completion queues (explicit only,
+            // enforced by PhiloteConfig::Validate)
+            auto discipline = std::make_shared<JuliaExplicitDiscipline>(
+                config.discipline);
+            async_server = std::make_unique<JuliaAsyncServer>(
+                discipline, config.server.cq_threads);
+            async_server->RegisterServices(builder);
+            multipoint_service = std::make_unique<JuliaMultiPointService>(
+                discipline, config.discipline.max_multipoint_points);
+            builder.RegisterService(multipoint_service.get());
+            layout_service = std::make_unique<JuliaLayoutService>(discipline);
+            builder.RegisterService(layout_service.get());
+            sparse_service =
+                std::make_unique<JuliaSparseGradientService>(discipline);
+            builder.RegisterService(sparse_service.get());
+            std::cout << "Julia explicit discipline loaded successfully." << std::endl;
+        } else if (config.discipline.kind == "explicit") {
             auto discipline = std::make_shared<JuliaExplicitDiscipline>(
                 config.discipline);
             discipline->RegisterServices(builder);
+            multipoint_service = std::make_unique<JuliaMultiPointService>(
+                discipline, config.discipline.max_multipoint_points);
+            builder.RegisterService(multipoint_service.get());
+            layout_service = std::make_unique<JuliaLayoutService>(discipline);
+            builder.RegisterService(layout_service.get());
+            sparse_service =
+                std::make_unique<JuliaSparseGradientService>(discipline);
+            builder.RegisterService(sparse_service.get());
             std::cout << "Julia explicit discipline loaded successfully." << std::endl;
         } else if (config.discipline.kind == "implicit") {
             auto discipline = std::make_shared<JuliaImplicitDiscipline>(
@@ -104,6 +179,10 @@ int main(int argc, char** argv) {
             throw std::runtime_error("Failed to start gRPC server");
         }
 
+        if (async_server) {
+            async_server->Start();
+        }
+
         std::cout << "gRPC server built successfully." << std::endl;
 
         // Setup signal handlers
@@ -119,6 +198,17 @@ int main(int argc, char** argv) {
         // 6. Wait for shutdown signal
         g_server->Wait();
 
+        if (async_server) {
+            async_server->Shutdown();
+        }
+
+        philote::julia::GCCounts gc_counts =
+            philote::julia::JuliaExecutor::CollectionCounts();
+        std::cout << "\nJulia GC: " << gc_counts.during_tasks
+                  << " collection(s) during requests, "
+                  << gc_counts.outside_tasks << " outside ("
+                  << gc_counts.idle << " idle, " << gc_counts.idle_full
+                  << " of them full)" << std::endl;
         std::cout << "\nServer shutdown complete." << std::endl;
 
     } catch (const std::exception& e) {
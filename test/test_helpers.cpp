@@ -71,6 +71,26 @@ std::string GetTestDisciplinePath(const std::string& filename) {
                            " (searched from " + cwd.string() + ")");
 }
 
+philote::VariableMetaData MakeMeta(const std::string& name,
+                                   philote::VariableType type,
+                                   const std::vector<int64_t>& shape) {
+    philote::VariableMetaData meta;
+    meta.set_name(name);
+    meta.set_type(type);
+    for (int64_t dim : shape) {
+        meta.add_shape(dim);
+    }
+    return meta;
+}
+
+philote::PartialsMetaData MakePartial(const std::string& output,
+                                      const std::string& input) {
+    philote::PartialsMetaData meta;
+    meta.set_name(output);
+    meta.set_subname(input);
+    return meta;
+}
+
 void ExpectVariableEquals(const philote::Variable& expected,
                           const philote::Variable& actual,
                           double tolerance) {
@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 #include <string>
+#include <vector>
 #include <fstream>
 #include <filesystem>
 
@@ -28,8 +29,9 @@ public:
         // Initialize Julia runtime singleton
         JuliaRuntime::GetInstance();
 
-        // Start executor thread (only once for all tests)
-        JuliaExecutor::GetInstance().Start();
+        // Start executor workers (only once for all tests). Two workers so
+        // TaskAffinity::kAnyWorker tasks can actually run concurrently.
+        JuliaExecutor::GetInstance().Start(2);
     }
 
     void TearDown() override {
@@ -95,6 +97,22 @@ int FindAvailablePort();
  */
 std::shared_ptr<grpc::Channel> CreateTestChannel(const std::string& address);
 
+/**
+ * @brief Variable metadata as a discipline's setup would declare it
+ * @param name Variable name
+ * @param type kInput or kOutput
+ * @param shape Variable shape
+ */
+philote::VariableMetaData MakeMeta(const std::string& name,
+                                   philote::VariableType type,
+                                   const std::vector<int64_t>& shape);
+
+/**
+ * @brief Metadata of the partial of output with respect to input
+ */
+philote::PartialsMetaData MakePartial(const std::string& output,
+                                      const std::string& input);
+
 /**
  * @brief Verify gradient correctness using numerical differentiation
  * @param discipline Pointer to discipline to test
@@ -0,0 +1,189 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <grpcpp/grpcpp.h>
+
+#include <memory>
+#include <string>
+
+#include <explicit.h>
+#include <explicit.grpc.pb.h>
+
+#include "julia_async_server.h"
+#include "julia_config.h"
+#include "julia_explicit_discipline.h"
+#include "test_helpers.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+namespace {
+
+constexpr int kPollers = 2;
+
+}  // namespace
+
+// Drives an in-process async server hosting the paraboloid discipline
+// through real gRPC clients
+class JuliaAsyncServerTest : public JuliaTestFixture {
+protected:
+    static void SetUpTestSuite() {
+        DisciplineConfig config;
+        config.kind = "explicit";
+        config.julia_file = GetTestDisciplinePath("paraboloid.jl");
+        config.julia_type = "ParaboloidDiscipline";
+        discipline_ = std::make_shared<JuliaExplicitDiscipline>(config);
+
+        int port = 0;
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort("127.0.0.1:0",
+                                 grpc::InsecureServerCredentials(), &port);
+        async_server_ = std::make_unique<JuliaAsyncServer>(discipline_, kPollers);
+        async_server_->RegisterServices(builder);
+        server_ = builder.BuildAndStart();
+        ASSERT_NE(server_, nullptr);
+        async_server_->Start();
+        address_ = "127.0.0.1:" + std::to_string(port);
+
+        client_ = std::make_unique<philote::ExplicitClient>();
+        client_->ConnectChannel(CreateTestChannel(address_));
+        client_->SendStreamOptions();
+        client_->Setup();
+        client_->GetVariableDefinitions();
+        client_->GetPartialDefinitions();
+    }
+
+    static void TearDownTestSuite() {
+        client_.reset();
+        if (server_) {
+            server_->Shutdown();
+        }
+        if (async_server_) {
+            async_server_->Shutdown();
+        }
+        async_server_.reset();
+        server_.reset();
+        discipline_.reset();
+    }
+
+    static philote::Variables MakeInputs(double x, double y) {
+        philote::Variables inputs;
+        inputs["x"] = philote::Variable(philote::kInput, {1});
+        inputs["y"] = philote::Variable(philote::kInput, {1});
+        inputs["x"](0) = x;
+        inputs["y"](0) = y;
+        return inputs;
+    }
+
+    static philote::Array MakeChunk(const std::string& name, double value) {
+        philote::Array chunk;
+        chunk.set_name(name);
+        chunk.set_start(0);
+        chunk.set_end(1);
+        chunk.set_type(philote::kInput);
+        chunk.add_data(value);
+        return chunk;
+    }
+
+    static std::shared_ptr<JuliaExplicitDiscipline> discipline_;
+    static std::unique_ptr<JuliaAsyncServer> async_server_;
+    static std::unique_ptr<grpc::Server> server_;
+    static std::unique_ptr<philote::ExplicitClient> client_;
+    static std::string address_;
+};
+
+std::shared_ptr<JuliaExplicitDiscipline> JuliaAsyncServerTest::discipline_;
+std::unique_ptr<JuliaAsyncServer> JuliaAsyncServerTest::async_server_;
+std::unique_ptr<grpc::Server> JuliaAsyncServerTest::server_;
+std::unique_ptr<philote::ExplicitClient> JuliaAsyncServerTest::client_;
+std::string JuliaAsyncServerTest::address_;
+
+TEST_F(JuliaAsyncServerTest, ComputeFunction) {
+    philote::Variables outputs = client_->ComputeFunction(MakeInputs(3.0, 4.0));
+
+    ASSERT_EQ(outputs.count("f"), 1u);
+    EXPECT_DOUBLE_EQ(outputs["f"](0), 25.0);
+}
+
+TEST_F(JuliaAsyncServerTest, ComputeGradient) {
+    philote::Partials partials = client_->ComputeGradient(MakeInputs(3.0, 4.0));
+
+    auto df_dx = partials.find({"f", "x"});
+    auto df_dy = partials.find({"f", "y"});
+    ASSERT_NE(df_dx, partials.end());
+    ASSERT_NE(df_dy, partials.end());
+    EXPECT_DOUBLE_EQ(df_dx->second(0), 6.0);
+    EXPECT_DOUBLE_EQ(df_dy->second(0), 8.0);
+}
+
+TEST_F(JuliaAsyncServerTest, ComputeFunctionFromRawStream) {
+    auto stub = philote::ExplicitService::NewStub(CreateTestChannel(address_));
+    grpc::ClientContext context;
+    auto stream = stub->ComputeFunction(&context);
+
+    ASSERT_TRUE(stream->Write(MakeChunk("x", 1.0)));
+    ASSERT_TRUE(stream->Write(MakeChunk("y", 2.0)));
+    ASSERT_TRUE(stream->WritesDone());
+
+    philote::Array result;
+    ASSERT_TRUE(stream->Read(&result));
+    EXPECT_EQ(result.name(), "f");
+    ASSERT_EQ(result.data_size(), 1);
+    EXPECT_DOUBLE_EQ(result.data(0), 5.0);
+    EXPECT_FALSE(stream->Read(&result));
+    EXPECT_TRUE(stream->Finish().ok());
+}
+
+TEST_F(JuliaAsyncServerTest, IncompleteInputsAreCancelled) {
+    auto stub = philote::ExplicitService::NewStub(CreateTestChannel(address_));
+    grpc::ClientContext context;
+    auto stream = stub->ComputeFunction(&context);
+
+    // Stream closes with "y" never sent
+    ASSERT_TRUE(stream->Write(MakeChunk("x", 1.0)));
+    ASSERT_TRUE(stream->WritesDone());
+
+    philote::Array result;
+    EXPECT_FALSE(stream->Read(&result));
+    EXPECT_EQ(stream->Finish().error_code(), grpc::StatusCode::CANCELLED);
+
+    // The server keeps serving complete requests
+    philote::Variables outputs = client_->ComputeFunction(MakeInputs(1.0, 1.0));
+    EXPECT_DOUBLE_EQ(outputs["f"](0), 2.0);
+}
+
+TEST_F(JuliaAsyncServerTest, ResentChunkDoesNotCoverMissingInput) {
+    auto stub = philote::ExplicitService::NewStub(CreateTestChannel(address_));
+    grpc::ClientContext context;
+    auto stream = stub->ComputeFunction(&context);
+
+    // "x" twice adds up to as many elements as "x" and "y"
+    ASSERT_TRUE(stream->Write(MakeChunk("x", 1.0)));
+    ASSERT_TRUE(stream->Write(MakeChunk("x", 2.0)));
+    ASSERT_TRUE(stream->WritesDone());
+
+    philote::Array result;
+    EXPECT_FALSE(stream->Read(&result));
+    EXPECT_EQ(stream->Finish().error_code(), grpc::StatusCode::CANCELLED);
+}
+
+TEST_F(JuliaAsyncServerTest, UnknownInputIsRejected) {
+    auto stub = philote::ExplicitService::NewStub(CreateTestChannel(address_));
+    grpc::ClientContext context;
+    auto stream = stub->ComputeFunction(&context);
+
+    stream->Write(MakeChunk("z", 1.0));
+    stream->WritesDone();
+
+    philote::Array result;
+    EXPECT_FALSE(stream->Read(&result));
+    EXPECT_EQ(stream->Finish().error_code(),
+              grpc::StatusCode::INVALID_ARGUMENT);
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
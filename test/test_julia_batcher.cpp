@@ -0,0 +1,186 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "julia_batcher.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+namespace {
+
+// Doubles every input and records the size of each batch it sees
+class DoublingBatch {
+public:
+    std::vector<int> operator()(const std::vector<const int*>& inputs) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            batch_sizes_.push_back(inputs.size());
+        }
+        std::vector<int> results;
+        for (const int* input : inputs) {
+            results.push_back(*input * 2);
+        }
+        return results;
+    }
+
+    std::vector<size_t> BatchSizes() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return batch_sizes_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<size_t> batch_sizes_;
+};
+
+// Submit `count` requests from as many threads, released together
+std::vector<int> SubmitConcurrently(RequestBatcher<int, int>& batcher,
+                                    int count) {
+    std::vector<int> results(count);
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < count; ++i) {
+        threads.emplace_back([&, i]() {
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            int input = i;
+            results[i] = batcher.Submit(input);
+        });
+    }
+    go.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return results;
+}
+
+}  // namespace
+
+TEST(RequestBatcherTest, SingleRequest) {
+    DoublingBatch batch;
+    RequestBatcher<int, int> batcher(std::ref(batch), 8,
+                                     std::chrono::microseconds(0),
+                                     TaskAffinity::kSerial);
+    int input = 21;
+    EXPECT_EQ(batcher.Submit(input), 42);
+    EXPECT_EQ(batch.BatchSizes(), std::vector<size_t>{1});
+}
+
+TEST(RequestBatcherTest, CoalescesConcurrentRequests) {
+    constexpr int kRequests = 8;
+    DoublingBatch batch;
+    RequestBatcher<int, int> batcher(std::ref(batch), kRequests,
+                                     std::chrono::milliseconds(200),
+                                     TaskAffinity::kSerial);
+
+    std::vector<int> results = SubmitConcurrently(batcher, kRequests);
+    for (int i = 0; i < kRequests; ++i) {
+        EXPECT_EQ(results[i], 2 * i);
+    }
+
+    std::vector<size_t> sizes = batch.BatchSizes();
+    size_t total = 0;
+    for (size_t size : sizes) {
+        total += size;
+    }
+    EXPECT_EQ(total, static_cast<size_t>(kRequests));
+    EXPECT_LT(sizes.size(), static_cast<size_t>(kRequests));
+}
+
+TEST(RequestBatcherTest, RespectsMaxBatchSize) {
+    DoublingBatch batch;
+    RequestBatcher<int, int> batcher(std::ref(batch), 2,
+                                     std::chrono::milliseconds(50),
+                                     TaskAffinity::kAnyWorker);
+
+    std::vector<int> results = SubmitConcurrently(batcher, 6);
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(results[i], 2 * i);
+    }
+    for (size_t size : batch.BatchSizes()) {
+        EXPECT_LE(size, 2u);
+    }
+}
+
+TEST(RequestBatcherTest, BatchFailureReachesEveryCaller) {
+    RequestBatcher<int, int> batcher(
+        [](const std::vector<const int*>&) -> std::vector<int> {
+            throw std::runtime_error("batch failed");
+        },
+        4, std::chrono::milliseconds(20), TaskAffinity::kSerial);
+
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&]() {
+            int input = 1;
+            try {
+                batcher.Submit(input);
+            } catch (const std::runtime_error&) {
+                ++failures;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(failures.load(), 4);
+}
+
+TEST(RequestBatcherTest, WrongResultCountIsAnError) {
+    RequestBatcher<int, int> batcher(
+        [](const std::vector<const int*>&) { return std::vector<int>{}; }, 4,
+        std::chrono::microseconds(0), TaskAffinity::kSerial);
+    int input = 1;
+    EXPECT_THROW(batcher.Submit(input), std::runtime_error);
+}
+
+TEST(RequestBatcherTest, SubmitAsync) {
+    DoublingBatch batch;
+    RequestBatcher<int, int> batcher(std::ref(batch), 4,
+                                     std::chrono::milliseconds(20),
+                                     TaskAffinity::kSerial);
+
+    int a = 1;
+    int b = 2;
+    TaskHandle<int> first = batcher.SubmitAsync(a);
+    TaskHandle<int> second = batcher.SubmitAsync(b);
+    EXPECT_EQ(first.Get(), 2);
+    EXPECT_EQ(second.Get(), 4);
+    EXPECT_EQ(batch.BatchSizes(), std::vector<size_t>{2});
+}
+
+TEST(RequestBatcherTest, SubmitWhileStoppedThrowsAndRecovers) {
+    DoublingBatch batch;
+    RequestBatcher<int, int> batcher(std::ref(batch), 4,
+                                     std::chrono::microseconds(0),
+                                     TaskAffinity::kAnyWorker);
+    JuliaExecutor& executor = JuliaExecutor::GetInstance();
+    int workers = executor.NumWorkers();
+
+    executor.Stop();
+    int input = 3;
+    EXPECT_THROW(batcher.Submit(input), std::runtime_error);
+    EXPECT_THROW(batcher.SubmitAsync(input), std::runtime_error);
+
+    // The failed submissions left no request counted, so the next one
+    // schedules a drain
+    executor.Start(workers);
+    EXPECT_EQ(batcher.Submit(input), 6);
+    EXPECT_EQ(batcher.SubmitAsync(input).Get(), 6);
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
@@ -3,6 +3,9 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+
 #include "julia_config.h"
 
 using philote::julia::PhiloteConfig;
@@ -31,3 +34,166 @@ TEST(JuliaConfigTest, ValidateThreads) {
     config.max_threads = 10;
     EXPECT_NO_THROW(config.Validate());
 }
+
+TEST(JuliaConfigTest, ValidateExecutor) {
+    ServerConfig config;
+    EXPECT_EQ(config.executor_mode, "serial");
+    EXPECT_EQ(config.executor_workers, 1);
+    EXPECT_NO_THROW(config.Validate());
+
+    config.executor_mode = "threaded";
+    EXPECT_THROW(config.Validate(), std::runtime_error);
+
+    config.executor_mode = "serial";
+    config.executor_workers = 4;
+    EXPECT_THROW(config.Validate(), std::runtime_error);
+
+    config.executor_mode = "parallel";
+    EXPECT_NO_THROW(config.Validate());
+
+    config.executor_workers = 0;
+    EXPECT_THROW(config.Validate(), std::runtime_error);
+
+    // Julia's own thread count does not follow the worker count
+    config.executor_workers = 4;
+    EXPECT_EQ(config.julia_threads, 1);
+    EXPECT_NO_THROW(config.Validate());
+    config.julia_threads = 0;
+    EXPECT_THROW(config.Validate(), std::runtime_error);
+}
+
+TEST(JuliaConfigTest, ValidateServerMode) {
+    ServerConfig config;
+    EXPECT_EQ(config.server_mode, "sync");
+    EXPECT_EQ(config.cq_threads, 2);
+    EXPECT_NO_THROW(config.Validate());
+
+    config.server_mode = "callback";
+    EXPECT_THROW(config.Validate(), std::runtime_error);
+
+    config.server_mode = "async";
+    EXPECT_NO_THROW(config.Validate());
+
+    config.cq_threads = 0;
+    EXPECT_THROW(config.Validate(), std::runtime_error);
+}
+
+TEST(JuliaConfigTest, ValidateGCPolicy) {
+    ServerConfig config;
+    EXPECT_FALSE(config.gc_defer_in_tasks);
+    EXPECT_EQ(config.gc_idle_ms, 0);
+    EXPECT_EQ(config.gc_full_threshold_mb, 0);
+
+    config.gc_defer_in_tasks = true;
+    config.gc_idle_ms = 50;
+    config.gc_full_threshold_mb = 512;
+    EXPECT_NO_THROW(config.Validate());
+
+    config.gc_idle_ms = -1;
+    EXPECT_THROW(config.Validate(), std::runtime_error);
+
+    config.gc_idle_ms = 50;
+    config.gc_full_threshold_mb = -1;
+    EXPECT_THROW(config.Validate(), std::runtime_error);
+
+    // Deferral is only bounded by the threshold
+    config.gc_full_threshold_mb = 0;
+    EXPECT_THROW(config.Validate(), std::runtime_error);
+    config.gc_defer_in_tasks = false;
+    EXPECT_NO_THROW(config.Validate());
+}
+
+TEST(JuliaConfigTest, ValidateBatching) {
+    DisciplineConfig config;
+    config.kind = "explicit";
+    config.julia_file = "/tmp/test.jl";
+    config.julia_type = "TestDiscipline";
+    EXPECT_EQ(config.batch_size, 1);
+    EXPECT_EQ(config.batch_window_us, 0);
+
+    // Batching settings are checked before the file exists check
+    config.batch_size = 0;
+    try {
+        config.Validate();
+        FAIL() << "Expected batch_size to be rejected";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("batch_size"), std::string::npos);
+    }
+
+    config.batch_size = 8;
+    config.batch_window_us = -1;
+    try {
+        config.Validate();
+        FAIL() << "Expected batch_window_us to be rejected";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("batch_window_us"),
+                  std::string::npos);
+    }
+
+    config.batch_window_us = 0;
+    EXPECT_EQ(config.max_multipoint_points, 1024);
+    config.max_multipoint_points = 0;
+    try {
+        config.Validate();
+        FAIL() << "Expected max_multipoint_points to be rejected";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("max_multipoint_points"),
+                  std::string::npos);
+    }
+}
+
+TEST(JuliaConfigTest, ValidateArrayLayout) {
+    DisciplineConfig config;
+    config.kind = "explicit";
+    config.julia_file = "/tmp/test.jl";
+    config.julia_type = "TestDiscipline";
+    EXPECT_TRUE(config.array_layout.empty());
+
+    // Layouts are checked before the file exists check
+    config.array_layout = "fortran";
+    try {
+        config.Validate();
+        FAIL() << "Expected array_layout to be rejected";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("array_layout"),
+                  std::string::npos);
+    }
+
+    config.array_layout = "column_major";
+    config.variable_layouts["f~x"] = "transposed";
+    try {
+        config.Validate();
+        FAIL() << "Expected variable layout to be rejected";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("f~x"), std::string::npos);
+    }
+}
+
+TEST(JuliaConfigTest, SysimageResolvedAndValidated) {
+    std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "philote_sysimage_test";
+    std::filesystem::create_directories(dir);
+    std::ofstream(dir / "disc.jl") << "struct TestDiscipline end\n";
+    std::ofstream(dir / "config.yaml")
+        << "discipline:\n"
+        << "  kind: explicit\n"
+        << "  julia_file: disc.jl\n"
+        << "  julia_type: TestDiscipline\n"
+        << "  sysimage: disc.so\n";
+
+    // The image is resolved next to the YAML file and must exist
+    std::filesystem::remove(dir / "disc.so");
+    try {
+        PhiloteConfig::FromYaml((dir / "config.yaml").string());
+        FAIL() << "Expected missing sysimage to be rejected";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("sysimage"), std::string::npos);
+    }
+
+    std::ofstream(dir / "disc.so") << "";
+    PhiloteConfig config =
+        PhiloteConfig::FromYaml((dir / "config.yaml").string());
+    EXPECT_EQ(config.discipline.sysimage, (dir / "disc.so").string());
+
+    std::filesystem::remove_all(dir);
+}
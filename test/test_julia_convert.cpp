@@ -4,10 +4,13 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "julia_config.h"
 #include "julia_convert.h"
+#include "julia_explicit_discipline.h"
 #include "julia_runtime.h"
 #include "julia_thread.h"
 #include "julia_executor.h"
+#include "julia_gc.h"
 #include "test_helpers.h"
 
 namespace philote {
@@ -155,6 +158,209 @@ TEST_F(JuliaConvertTest, DISABLED_RoundtripMultipleVariables) {
     EXPECT_TRUE(result);
 }
 
+TEST_F(JuliaConvertTest, Tensor3DMatchesJuliaIndexing) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        // t[i, j, k] = 100i + 10j + k (1-based), stored row-major
+        Variables vars;
+        vars["t"] = Variable(philote::kOutput, {2, 3, 4});
+        for (size_t i = 0; i < 2; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                for (size_t k = 0; k < 4; ++k) {
+                    vars["t"]((i * 3 + j) * 4 + k) =
+                        100.0 * (i + 1) + 10.0 * (j + 1) + (k + 1);
+                }
+            }
+        }
+
+        jl_value_t* dict = VariablesToJuliaDict(vars);
+        if (!dict) return false;
+        GCProtect dict_protect(dict);
+
+        jl_value_t* check_fn = jl_eval_string(
+            "d -> (t = d[\"t\"]; size(t) == (2, 3, 4) && "
+            "all(t[i, j, k] == 100i + 10j + k "
+            "for i in 1:2, j in 1:3, k in 1:4))");
+        if (!check_fn) return false;
+        GCProtect check_protect(check_fn);
+        jl_value_t* matches = jl_call1(check_fn, dict);
+        if (jl_exception_occurred() || !matches || !jl_unbox_bool(matches)) {
+            return false;
+        }
+
+        Variables vars_back = JuliaDictToVariables(dict);
+        const auto& t = vars_back.at("t");
+        if (t.Shape() != std::vector<size_t>{2, 3, 4}) return false;
+        for (size_t n = 0; n < t.Size(); ++n) {
+            if (t(n) != vars["t"](n)) return false;
+        }
+        return true;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaConvertTest, ColumnMajorVariablesPassThrough) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        // m[i, j] = 10i + j (1-based) stored column-major, next to a
+        // row-major matrix with the same values
+        Variables vars;
+        vars["m"] = Variable(philote::kOutput, {2, 3});
+        vars["r"] = Variable(philote::kOutput, {2, 3});
+        for (size_t i = 0; i < 2; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                double value = 10.0 * (i + 1) + (j + 1);
+                vars["m"](j * 2 + i) = value;
+                vars["r"](i * 3 + j) = value;
+            }
+        }
+
+        ArrayLayoutMap layouts;
+        layouts.Set("m", ArrayLayout::kColumnMajor);
+
+        jl_value_t* dict = WrapVariablesAsJuliaDict(vars, layouts);
+        if (!dict) return false;
+        GCProtect dict_protect(dict);
+
+        jl_value_t* check_fn = jl_eval_string(
+            "d -> d[\"m\"] == d[\"r\"] == [11.0 12.0 13.0; 21.0 22.0 23.0]");
+        if (!check_fn) return false;
+        GCProtect check_protect(check_fn);
+        jl_value_t* matches = jl_call1(check_fn, dict);
+        if (jl_exception_occurred() || !matches || !jl_unbox_bool(matches)) {
+            return false;
+        }
+
+        // The column-major matrix wraps the caller's buffer
+        jl_value_t* key = jl_cstr_to_string("m");
+        GCProtect key_protect(key);
+        jl_value_t* m = jl_call2(
+            jl_get_function(jl_base_module, "getindex"), dict, key);
+        if (!m || jl_array_data(reinterpret_cast<jl_array_t*>(m), double) !=
+                      &vars["m"](0)) {
+            return false;
+        }
+
+        Variables vars_back = JuliaDictToVariables(dict, layouts);
+        for (size_t n = 0; n < 6; ++n) {
+            if (vars_back.at("m")(n) != vars["m"](n)) return false;
+            if (vars_back.at("r")(n) != vars["r"](n)) return false;
+        }
+        return true;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaConvertTest, SetupConvertersMatchPerCallConverters) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        // Row-major m {2, 3} and Float32 u {3}, as declared at setup
+        std::vector<philote::VariableMetaData> meta = {
+            MakeMeta("m", philote::kInput, {2, 3}),
+            MakeMeta("u", philote::kInput, {3})};
+        ArrayLayoutMap layouts;
+        layouts.SetElementType("u", ElementType::kFloat32);
+        VariableConverterMap converters = MakeVariableConverters(meta, layouts);
+        if (converters.at("m").converter.rank() != 2) return false;
+
+        Variables vars;
+        vars["m"] = Variable(philote::kInput, {2, 3});
+        vars["u"] = Variable(philote::kInput, {3});
+        for (size_t n = 0; n < 6; ++n) {
+            vars["m"](n) = static_cast<double>(n);
+        }
+        for (size_t n = 0; n < 3; ++n) {
+            vars["u"](n) = 0.5 * static_cast<double>(n);
+        }
+
+        jl_value_t* dict = VariablesToJuliaDict(vars, layouts, &converters);
+        if (!dict) return false;
+        GCProtect dict_protect(dict);
+        jl_value_t* check_fn = jl_eval_string(
+            "d -> d[\"m\"] == [0.0 1.0 2.0; 3.0 4.0 5.0] && "
+            "d[\"u\"] == Float32[0.0, 0.5, 1.0]");
+        if (!check_fn) return false;
+        GCProtect check_protect(check_fn);
+        jl_value_t* matches = jl_call1(check_fn, dict);
+        if (jl_exception_occurred() || !matches || !jl_unbox_bool(matches)) {
+            return false;
+        }
+
+        Variables vars_back = JuliaDictToVariables(dict, layouts, &converters);
+        for (size_t n = 0; n < 6; ++n) {
+            if (vars_back.at("m")(n) != vars["m"](n)) return false;
+        }
+
+        // A shape other than the declared one gets its own converter
+        Variables reshaped;
+        reshaped["m"] = Variable(philote::kInput, {3, 2});
+        for (size_t n = 0; n < 6; ++n) {
+            reshaped["m"](n) = static_cast<double>(n);
+        }
+        jl_value_t* other = VariablesToJuliaDict(reshaped, layouts, &converters);
+        if (!other) return false;
+        GCProtect other_protect(other);
+        jl_value_t* check_other = jl_eval_string(
+            "d -> d[\"m\"] == [0.0 1.0; 2.0 3.0; 4.0 5.0]");
+        if (!check_other) return false;
+        GCProtect check_other_protect(check_other);
+        matches = jl_call1(check_other, other);
+        return !jl_exception_occurred() && matches && jl_unbox_bool(matches);
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaConvertTest, Float32VariablesAreNarrowed) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        // A Float32 matrix next to a Float64 vector
+        Variables vars;
+        vars["u"] = Variable(philote::kInput, {2, 3});
+        vars["s"] = Variable(philote::kInput, {1});
+        for (size_t n = 0; n < 6; ++n) {
+            vars["u"](n) = 0.5 * static_cast<double>(n);
+        }
+        vars["s"](0) = 2.0;
+
+        ArrayLayoutMap layouts;
+        layouts.SetElementType("u", ElementType::kFloat32);
+
+        jl_value_t* dict = WrapVariablesAsJuliaDict(vars, layouts);
+        if (!dict) return false;
+        GCProtect dict_protect(dict);
+
+        jl_value_t* check_fn = jl_eval_string(
+            "d -> d isa Dict{String,Array} && "
+            "d[\"u\"] isa Matrix{Float32} && d[\"s\"] isa Vector{Float64} && "
+            "d[\"u\"] == Float32[0.0 0.5 1.0; 1.5 2.0 2.5]");
+        if (!check_fn) return false;
+        GCProtect check_protect(check_fn);
+        jl_value_t* matches = jl_call1(check_fn, dict);
+        if (jl_exception_occurred() || !matches || !jl_unbox_bool(matches)) {
+            return false;
+        }
+
+        // Float32 results are widened back, whatever the declared type
+        Variables vars_back = JuliaDictToVariables(dict, layouts);
+        for (size_t n = 0; n < 6; ++n) {
+            if (vars_back.at("u")(n) != vars["u"](n)) return false;
+        }
+        if (vars_back.at("s")(0) != 2.0) return false;
+
+        // Reusable dicts preallocate Float32 arrays and keep the type
+        JuliaReusableDict reusable;
+        jl_value_t* reused = reusable.Reset(vars, true, layouts);
+        GCProtect reused_protect(reused);
+        vars["u"](5) = 7.0;
+        if (reusable.Update(vars) != reused) return false;
+        Variables read = vars;
+        read["u"](5) = 0.0;
+        reusable.Read(read);
+        return read["u"](5) == 7.0;
+    });
+
+    EXPECT_TRUE(result);
+}
+
 TEST_F(JuliaConvertTest, RoundtripZeroValues) {
     auto result = JuliaExecutor::GetInstance().Submit([]() {
         Variables vars;
@@ -227,6 +433,251 @@ TEST_F(JuliaConvertTest, RoundtripLargeVector) {
     EXPECT_TRUE(result);
 }
 
+// WrapVariablesAsJuliaDict tests
+
+TEST_F(JuliaConvertTest, WrapSharesVectorBuffer) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        Variables vars;
+        vars["x"] = Variable(philote::kInput, {4});
+        for (size_t i = 0; i < 4; ++i) {
+            vars["x"](i) = static_cast<double>(i);
+        }
+
+        jl_value_t* dict = WrapVariablesAsJuliaDict(vars);
+        if (!dict) return false;
+        GCProtect dict_protect(dict);
+
+        jl_function_t* getindex_fn = jl_get_function(jl_base_module, "getindex");
+        jl_value_t* key = jl_cstr_to_string("x");
+        GCProtect key_protect(key);
+        jl_value_t* array = jl_call2(getindex_fn, dict, key);
+        if (!array || !jl_is_array(array)) return false;
+
+        // Julia sees the Variable's own storage, including later writes
+        double* jl_data = jl_array_data(reinterpret_cast<jl_array_t*>(array), double);
+        if (jl_data != &vars["x"](0)) return false;
+        vars["x"](2) = 42.0;
+
+        Variables vars_back = JuliaDictToVariables(dict);
+        if (std::abs(vars_back.at("x")(2) - 42.0) > 1e-9) return false;
+        if (std::abs(vars_back.at("x")(3) - 3.0) > 1e-9) return false;
+
+        return true;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaConvertTest, WrapMatchesCopy) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        Variables vars;
+        vars["a"] = Variable(philote::kInput, {1});
+        vars["a"](0) = 1.5;
+        vars["b"] = Variable(philote::kInput, {3});
+        vars["b"](0) = -1.0;
+        vars["b"](1) = 0.0;
+        vars["b"](2) = 7.0;
+        vars["empty"] = Variable(philote::kInput, {0});
+
+        jl_value_t* dict = WrapVariablesAsJuliaDict(vars);
+        Variables vars_back = JuliaDictToVariables(dict);
+
+        if (vars_back.size() != 3) return false;
+        if (vars_back.at("empty").Size() != 0) return false;
+        if (std::abs(vars_back.at("a")(0) - 1.5) > 1e-9) return false;
+        for (size_t i = 0; i < 3; ++i) {
+            if (std::abs(vars_back.at("b")(i) - vars["b"](i)) > 1e-9) return false;
+        }
+
+        return true;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+// JuliaReusableDict tests
+
+TEST_F(JuliaConvertTest, ReusableDictUpdatesInPlace) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        Variables vars;
+        vars["x"] = Variable(philote::kInput, {3});
+        vars["y"] = Variable(philote::kInput, {1});
+
+        JuliaReusableDict reusable_dict;
+        if (reusable_dict.Update(vars) != nullptr) return false;  // Not built yet
+
+        jl_value_t* dict = reusable_dict.Reset(vars, false);
+        GCProtect dict_protect(dict);
+
+        jl_function_t* getindex_fn = jl_get_function(jl_base_module, "getindex");
+        jl_value_t* key = jl_cstr_to_string("x");
+        GCProtect key_protect(key);
+        jl_value_t* array = jl_call2(getindex_fn, dict, key);
+
+        vars["x"](0) = 1.0;
+        vars["x"](2) = 3.0;
+        vars["y"](0) = -2.0;
+        if (reusable_dict.Update(vars) != dict) return false;
+
+        // Same dict, same array, new contents
+        if (jl_call2(getindex_fn, dict, key) != array) return false;
+        Variables vars_back = JuliaDictToVariables(dict);
+        if (std::abs(vars_back.at("x")(0) - 1.0) > 1e-9) return false;
+        if (std::abs(vars_back.at("x")(2) - 3.0) > 1e-9) return false;
+        if (std::abs(vars_back.at("y")(0) - (-2.0)) > 1e-9) return false;
+
+        return true;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaConvertTest, ReusableDictRejectsLayoutChange) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        Variables vars;
+        vars["x"] = Variable(philote::kInput, {3});
+
+        JuliaReusableDict reusable_dict;
+        jl_value_t* dict = reusable_dict.Reset(vars, false);
+        GCProtect dict_protect(dict);
+
+        Variables resized;
+        resized["x"] = Variable(philote::kInput, {4});
+        if (reusable_dict.Update(resized) != nullptr) return false;
+
+        Variables extra = vars;
+        extra["z"] = Variable(philote::kInput, {1});
+        if (reusable_dict.Update(extra) != nullptr) return false;
+
+        Variables renamed;
+        renamed["w"] = Variable(philote::kInput, {3});
+        if (reusable_dict.Update(renamed) != nullptr) return false;
+
+        return reusable_dict.Update(vars) == dict;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaConvertTest, ReusableDictBorrowsLargeVectors) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        Variables vars;
+        vars["mesh"] = Variable(philote::kInput, {JuliaReusableDict::kMinBorrowSize});
+        vars["mesh"](7) = 7.0;
+
+        JuliaReusableDict reusable_dict;
+        jl_value_t* dict = reusable_dict.Reset(vars, true);
+        GCProtect dict_protect(dict);
+        if (reusable_dict.Update(vars) != dict) return false;
+
+        jl_function_t* getindex_fn = jl_get_function(jl_base_module, "getindex");
+        jl_value_t* key = jl_cstr_to_string("mesh");
+        GCProtect key_protect(key);
+        jl_value_t* array = jl_call2(getindex_fn, dict, key);
+        if (!array || !jl_is_array(array)) return false;
+
+        double* jl_data = jl_array_data(reinterpret_cast<jl_array_t*>(array), double);
+        return jl_data == &vars["mesh"](0) && jl_data[7] == 7.0;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaConvertTest, ReusableDictReadsInPlaceWrites) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        Variables vars;
+        vars["f"] = Variable(philote::kOutput, {2});
+        vars["g"] = Variable(philote::kOutput, {1});
+
+        JuliaReusableDict reusable_dict;
+        jl_value_t* dict = reusable_dict.Reset(vars, false);
+        GCProtect dict_protect(dict);
+
+        // Fill "f" in place and rebind "g" to a fresh array; both must be seen
+        jl_value_t* fill_fn = jl_eval_string(
+            "d -> (d[\"f\"] .= [5.0, 6.0]; d[\"g\"] = [7.0]; nothing)");
+        if (!fill_fn) return false;
+        GCProtect fill_protect(fill_fn);
+        jl_call1(fill_fn, dict);
+        if (jl_exception_occurred()) return false;
+
+        reusable_dict.Read(vars);
+        return vars["f"](0) == 5.0 && vars["f"](1) == 6.0 && vars["g"](0) == 7.0;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaConvertTest, ReusableDictReadRejectsResizedOutput) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        Variables vars;
+        vars["f"] = Variable(philote::kOutput, {2});
+
+        JuliaReusableDict reusable_dict;
+        jl_value_t* dict = reusable_dict.Reset(vars, false);
+        GCProtect dict_protect(dict);
+
+        jl_value_t* resize_fn = jl_eval_string("d -> (d[\"f\"] = [1.0]; nothing)");
+        if (!resize_fn) return false;
+        GCProtect resize_protect(resize_fn);
+        jl_call1(resize_fn, dict);
+        if (jl_exception_occurred()) return false;
+
+        try {
+            reusable_dict.Read(vars);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaConvertTest, ReusableDictReadChecksDimsAndElementType) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        Variables vars;
+        vars["u"] = Variable(philote::kOutput, {2, 3});
+        ArrayLayoutMap layouts;
+        layouts.SetElementType("u", ElementType::kFloat32);
+
+        JuliaReusableDict reusable_dict;
+        jl_value_t* dict = reusable_dict.Reset(vars, false, layouts);
+        GCProtect dict_protect(dict);
+
+        // Filled in place: a 2x3 Matrix{Float32} is read back
+        jl_value_t* fill_fn = jl_eval_string(
+            "d -> (d[\"u\"] .= Float32[1 2 3; 4 5 6]; nothing)");
+        if (!fill_fn) return false;
+        GCProtect fill_protect(fill_fn);
+        jl_call1(fill_fn, dict);
+        if (jl_exception_occurred()) return false;
+        reusable_dict.Read(vars);
+        if (vars["u"](1) != 2.0 || vars["u"](3) != 4.0) return false;
+
+        // Replaced by arrays of the right length but the wrong dims or
+        // element type
+        for (const char* replacement :
+             {"d -> (d[\"u\"] = zeros(Float32, 6); nothing)",
+              "d -> (d[\"u\"] = zeros(Float32, 3, 2); nothing)",
+              "d -> (d[\"u\"] = zeros(Float64, 2, 3); nothing)"}) {
+            jl_value_t* replace_fn = jl_eval_string(replacement);
+            if (!replace_fn) return false;
+            GCProtect replace_protect(replace_fn);
+            jl_call1(replace_fn, dict);
+            if (jl_exception_occurred()) return false;
+            try {
+                reusable_dict.Read(vars);
+                return false;
+            } catch (const std::runtime_error&) {
+            }
+        }
+        return true;
+    });
+
+    EXPECT_TRUE(result);
+}
+
 // JuliaDictToPartials tests
 
 TEST_F(JuliaConvertTest, PartialsSingleDerivative) {
@@ -301,6 +752,123 @@ TEST_F(JuliaConvertTest, PartialsMatrixJacobian) {
     EXPECT_TRUE(result);
 }
 
+TEST_F(JuliaConvertTest, SparsePartialsStayStored) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        // dK/du stored at (1,1) and (3,2) of a 3x2 block; dK/dp dense
+        const int64_t rows[] = {1, 3};
+        const int64_t cols[] = {1, 2};
+        SparsityPatterns patterns;
+        patterns[{"K", "u"}] = std::make_shared<const SparsityPattern>(
+            MakeSparsityPattern(rows, cols, 2, {3}, {2},
+                                ArrayLayout::kRowMajor));
+
+        jl_value_t* result_dict = jl_eval_string(
+            "Dict(\"K~u\" => [5.0, 7.0], \"K~p\" => [1.0, 2.0, 3.0])");
+        if (!result_dict || jl_exception_occurred()) return false;
+
+        SparsePartials sparse;
+        Partials dense = JuliaDictToSparsePartials(result_dict, patterns, sparse);
+
+        if (dense.size() != 1 || dense.count({"K", "p"}) == 0) return false;
+        if (sparse.size() != 1 || sparse.count({"K", "u"}) == 0) return false;
+        if (sparse.at({"K", "u"}).values != std::vector<double>({5.0, 7.0})) {
+            return false;
+        }
+
+        // Stored entries must match the pattern length
+        jl_value_t* wrong_dict = jl_eval_string("Dict(\"K~u\" => zeros(6))");
+        try {
+            JuliaDictToSparsePartials(wrong_dict, patterns, sparse);
+            return false;
+        } catch (const std::runtime_error&) {
+        }
+        return true;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaConvertTest, PartialsByBlockIndex) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        // Blocks: d(J {2,2})/dx {1}, d(f~g {1})/dx {1}; f~g is not parsed
+        PartialsBlockTable table(2);
+        table[0].key = {"J", "x"};
+        table[0].shape = {2, 2, 1};
+        table[0].size = 4;
+        table[1].key = {"f~g", "x"};
+        table[1].shape = {1, 1};
+        table[1].size = 1;
+        for (PartialsBlock& block : table) {
+            block.converter = ArrayConverter(block.shape, block.layout);
+        }
+
+        jl_value_t* blocks = jl_eval_string(
+            "Any[reshape([1.0, 2.0, 3.0, 4.0], 2, 2, 1), [5.0]]");
+        if (!blocks || jl_exception_occurred()) return false;
+        GCProtect blocks_protect(blocks);
+
+        SparsePartials sparse;
+        Partials partials = JuliaBlocksToPartials(blocks, table, sparse);
+        if (partials.size() != 2 || !sparse.empty()) return false;
+
+        // Julia J[2,1] (value 2.0) is row-major element (1, 0)
+        const auto& jacobian = partials.at({"J", "x"});
+        if (std::abs(jacobian(2) - 2.0) > 1e-9) return false;
+        if (std::abs(partials.at({"f~g", "x"})(0) - 5.0) > 1e-9) return false;
+
+        // nothing skips a block; a wrong count is rejected
+        jl_value_t* skipped = jl_eval_string("Any[nothing, [5.0]]");
+        GCProtect skipped_protect(skipped);
+        if (JuliaBlocksToPartials(skipped, table, sparse).size() != 1) {
+            return false;
+        }
+        jl_value_t* short_blocks = jl_eval_string("Any[[5.0]]");
+        GCProtect short_protect(short_blocks);
+        try {
+            JuliaBlocksToPartials(short_blocks, table, sparse);
+            return false;
+        } catch (const std::runtime_error&) {
+        }
+        return true;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaConvertTest, StackedOutputsMustBeColumnPerPoint) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        std::map<std::string, std::vector<size_t>> shapes = {{"f", {2}}};
+        auto split = [&shapes](const char* code) {
+            jl_value_t* dict = jl_eval_string(code);
+            GCProtect dict_protect(dict);
+            return JuliaDictToStackedVariables(dict, shapes, 3);
+        };
+        auto rejected = [&split](const char* code) {
+            try {
+                split(code);
+                return false;
+            } catch (const std::runtime_error&) {
+                return true;
+            }
+        };
+
+        // Column j is point j
+        auto points = split("Dict(\"f\" => [1.0 3.0 5.0; 2.0 4.0 6.0])");
+        if (points.size() != 3) return false;
+        if (std::abs(points[1].at("f")(0) - 3.0) > 1e-9) return false;
+        if (std::abs(points[2].at("f")(1) - 6.0) > 1e-9) return false;
+
+        // Right element count, wrong shape
+        if (!rejected("Dict(\"f\" => collect(1.0:6.0))")) return false;
+        if (!rejected("Dict(\"f\" => ones(3, 2))")) return false;
+        // Right shape, element type read as the wrong width
+        if (!rejected("Dict(\"f\" => ones(Int, 2, 3))")) return false;
+        return true;
+    });
+
+    EXPECT_TRUE(result);
+}
+
 // ProtobufStructToJuliaDict tests
 
 TEST_F(JuliaConvertTest, DISABLED_ProtobufStructWithNumbers) {
@@ -519,6 +1087,66 @@ TEST_F(JuliaConvertTest, InvalidJuliaDictToPartials) {
     EXPECT_TRUE(result);
 }
 
+// float32_field.jl end to end: Float32 and Float64 variables in one dict,
+// narrowed on the way in and widened on the way out
+TEST_F(JuliaConvertTest, Float32FieldDiscipline) {
+    DisciplineConfig config;
+    config.kind = "explicit";
+    config.julia_file = GetTestDisciplinePath("float32_field.jl");
+    config.julia_type = "Float32FieldDiscipline";
+    auto discipline = std::make_shared<JuliaExplicitDiscipline>(config);
+    static_cast<philote::Discipline&>(*discipline).Setup();
+    EXPECT_EQ(discipline->array_layouts().GetElementType("u"),
+              ElementType::kFloat32);
+    EXPECT_EQ(discipline->array_layouts().GetElementType("s"),
+              ElementType::kFloat64);
+
+    // Quarter steps are exact in Float32
+    Variables inputs;
+    inputs["u"] = Variable(philote::kInput, {4, 3});
+    inputs["s"] = Variable(philote::kInput, {1});
+    double sum = 0.0;
+    for (size_t n = 0; n < 12; ++n) {
+        inputs["u"](n) = 0.25 * static_cast<double>(n);
+        sum += inputs["u"](n);
+    }
+    inputs["s"](0) = 2.0;
+
+    auto& base = static_cast<philote::ExplicitDiscipline&>(*discipline);
+    Variables outputs;
+    base.Compute(inputs, outputs);
+    ASSERT_EQ(outputs.count("v"), 1u);
+    ASSERT_EQ(outputs.at("v").Size(), 12u);
+    for (size_t n = 0; n < 12; ++n) {
+        EXPECT_DOUBLE_EQ(outputs.at("v")(n), 2.0 * inputs["u"](n)) << n;
+    }
+    EXPECT_DOUBLE_EQ(outputs.at("total")(0), 2.0 * sum);
+
+    Partials partials;
+    base.ComputePartials(inputs, partials);
+    auto dv_ds = partials.find({"v", "s"});
+    auto dtotal_ds = partials.find({"total", "s"});
+    ASSERT_NE(dv_ds, partials.end());
+    ASSERT_NE(dtotal_ds, partials.end());
+    for (size_t n = 0; n < 12; ++n) {
+        EXPECT_DOUBLE_EQ(dv_ds->second(n), inputs["u"](n)) << n;
+    }
+    EXPECT_DOUBLE_EQ(dtotal_ds->second(0), sum);
+
+    // compute_batch asserts it gets Matrix{Float32} columns for u
+    Variables second = inputs;
+    second["s"](0) = 0.5;
+    std::vector<Variables> batched =
+        discipline->ComputeMultiPoint({inputs, second});
+    ASSERT_EQ(batched.size(), 2u);
+    for (size_t n = 0; n < 12; ++n) {
+        EXPECT_DOUBLE_EQ(batched[0].at("v")(n), 2.0 * inputs["u"](n)) << n;
+        EXPECT_DOUBLE_EQ(batched[1].at("v")(n), 0.5 * inputs["u"](n)) << n;
+    }
+    EXPECT_DOUBLE_EQ(batched[0].at("total")(0), 2.0 * sum);
+    EXPECT_DOUBLE_EQ(batched[1].at("total")(0), 0.5 * sum);
+}
+
 }  // namespace test
 }  // namespace julia
 }  // namespace philote
@@ -4,7 +4,15 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <array>
 #include <atomic>
+#include <cstdlib>
+#include <condition_variable>
+#include <coroutine>
+#include <future>
+#include <memory>
+#include <new>
+#include <mutex>
 #include <thread>
 #include <vector>
 #include <chrono>
@@ -14,6 +22,44 @@
 #include "julia_convert.h"
 #include "test_helpers.h"
 
+// Count C++ heap allocations while an AllocationCounter is alive, so
+// executor round trips can be checked for allocations. The replacement is
+// program-wide, but outside a counting test it only adds a relaxed load.
+namespace {
+std::atomic<bool> g_count_allocations{false};
+std::atomic<size_t> g_allocation_count{0};
+
+// Counts allocations on any thread (workers included) for its lifetime
+class AllocationCounter {
+public:
+    AllocationCounter() {
+        g_allocation_count.store(0);
+        g_count_allocations.store(true);
+    }
+    ~AllocationCounter() { g_count_allocations.store(false); }
+
+    size_t Count() const { return g_allocation_count.load(); }
+};
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (g_count_allocations.load(std::memory_order_relaxed)) {
+        g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
 namespace philote {
 namespace julia {
 namespace test {
@@ -286,6 +332,324 @@ TEST_F(JuliaExecutorTest, ConcurrentSubmissionsWithDifferentReturnTypes) {
     EXPECT_EQ(string_count, 10);
 }
 
+// Multi-worker tests
+
+TEST_F(JuliaExecutorTest, StopRunsQueuedTasksAndRejectsNewOnes) {
+    constexpr int kTasks = 200;
+    std::atomic<int> ran{0};
+    for (int i = 0; i < kTasks; ++i) {
+        executor_->Post([&ran]() { ran.fetch_add(1); },
+                        i % 2 ? TaskAffinity::kAnyWorker : TaskAffinity::kSerial);
+    }
+
+    executor_->Stop();
+    EXPECT_EQ(ran.load(), kTasks);
+    EXPECT_THROW(executor_->Submit([]() { return 0; }), std::runtime_error);
+    EXPECT_THROW(executor_->Post([]() {}), std::runtime_error);
+
+    // Restart for the remaining tests
+    executor_->Start(2);
+    EXPECT_EQ(executor_->Submit([]() { return 3; }), 3);
+}
+
+TEST_F(JuliaExecutorTest, StopUnderConcurrentSubmitRunsEveryAcceptedTask) {
+    constexpr int kProducers = 4;
+    std::atomic<int> accepted{0};
+    std::atomic<int> ran{0};
+    std::atomic<bool> started{false};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&, p]() {
+            TaskAffinity affinity =
+                p % 2 ? TaskAffinity::kAnyWorker : TaskAffinity::kSerial;
+            while (true) {
+                try {
+                    executor_->Post([&ran]() { ran.fetch_add(1); }, affinity);
+                } catch (const std::runtime_error&) {
+                    return;  // Stopped
+                }
+                accepted.fetch_add(1);
+                started.store(true);
+            }
+        });
+    }
+    while (!started.load()) {
+        std::this_thread::yield();
+    }
+
+    executor_->Stop();
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_GT(accepted.load(), 0);
+    EXPECT_EQ(ran.load(), accepted.load());
+
+    // Restart for the remaining tests
+    executor_->Start(2);
+    EXPECT_EQ(executor_->Submit([]() { return 3; }), 3);
+}
+
+TEST_F(JuliaExecutorTest, StartedWithMultipleWorkers) {
+    EXPECT_EQ(executor_->NumWorkers(), 2);
+}
+
+TEST_F(JuliaExecutorTest, CurrentWorkerIndex) {
+    EXPECT_EQ(JuliaExecutor::CurrentWorkerIndex(), -1);
+
+    // Serial tasks always run on the primary worker
+    EXPECT_EQ(executor_->Submit([]() {
+        return JuliaExecutor::CurrentWorkerIndex();
+    }), 0);
+
+    int index = executor_->Submit([]() {
+        return JuliaExecutor::CurrentWorkerIndex();
+    }, TaskAffinity::kAnyWorker);
+    EXPECT_GE(index, 0);
+    EXPECT_LT(index, executor_->NumWorkers());
+}
+
+TEST_F(JuliaExecutorTest, AnyWorkerTaskReturnsValue) {
+    auto result = executor_->Submit([]() {
+        jl_value_t* ret = jl_eval_string("3 * 7");
+        return static_cast<int>(jl_unbox_int64(ret));
+    }, TaskAffinity::kAnyWorker);
+
+    EXPECT_EQ(result, 21);
+}
+
+TEST_F(JuliaExecutorTest, AnyWorkerTasksRunConcurrently) {
+    // Two tasks that each wait for the other: only completes if they are
+    // running on different workers at the same time
+    std::mutex mutex;
+    std::condition_variable cv;
+    int arrived = 0;
+
+    auto rendezvous = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        ++arrived;
+        cv.notify_all();
+        return cv.wait_for(lock, 5s, [&] { return arrived == 2; });
+    };
+
+    std::atomic<bool> first_met{false};
+    std::thread other([&]() {
+        first_met = executor_->Submit(rendezvous, TaskAffinity::kAnyWorker);
+    });
+    bool second_met = executor_->Submit(rendezvous, TaskAffinity::kAnyWorker);
+    other.join();
+
+    EXPECT_TRUE(first_met);
+    EXPECT_TRUE(second_met);
+}
+
+TEST_F(JuliaExecutorTest, SerialTasksNeverOverlap) {
+    constexpr int num_threads = 8;
+    std::atomic<int> running{0};
+    std::atomic<bool> overlapped{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&]() {
+            executor_->Submit([&]() {
+                if (running.fetch_add(1) != 0) {
+                    overlapped = true;
+                }
+                std::this_thread::sleep_for(1ms);
+                running.fetch_sub(1);
+            });
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(overlapped);
+}
+
+// Allocation tests
+
+TEST_F(JuliaExecutorTest, SubmitRoundTripDoesNotAllocate) {
+    // Warm up both paths (first use may touch lazily initialized state)
+    executor_->Submit([]() { return 0; });
+    executor_->Submit([]() { return 0; }, TaskAffinity::kAnyWorker);
+
+    int sum = 0;
+    size_t allocations = 0;
+    {
+        AllocationCounter counter;
+        for (int i = 0; i < 100; ++i) {
+            sum += executor_->Submit([i]() { return i; });
+            sum += executor_->Submit([i]() { return i; },
+                                     TaskAffinity::kAnyWorker);
+        }
+        executor_->Submit([&sum]() { sum += 1; });
+        allocations = counter.Count();
+    }
+
+    EXPECT_EQ(sum, 2 * 4950 + 1);
+    EXPECT_EQ(allocations, 0u);
+}
+
+TEST_F(JuliaExecutorTest, SubmitMoveOnlyResult) {
+    auto result = executor_->Submit([]() {
+        return std::make_unique<int>(99);
+    });
+
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(*result, 99);
+}
+
+TEST_F(JuliaExecutorTest, TaskWithLargeCaptureFallsBackToHeap) {
+    std::array<double, 32> big{};
+    big[31] = 2.5;
+    double out = 0.0;
+
+    Task task([big, &out]() { out = big[31]; });
+    Task moved = std::move(task);
+    EXPECT_FALSE(task);
+    moved();
+
+    EXPECT_DOUBLE_EQ(out, 2.5);
+}
+
+// Asynchronous submission tests
+
+namespace {
+
+// Minimal eagerly-started coroutine type for exercising co_await
+struct DetachedCoroutine {
+    struct promise_type {
+        DetachedCoroutine get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+DetachedCoroutine AwaitTwoTasks(JuliaExecutor& executor,
+                                std::promise<int>& result) {
+    int a = co_await executor.SubmitAsync([]() { return 20; });
+    int b = co_await executor.SubmitAsync([]() {
+        jl_value_t* ret = jl_eval_string("11 * 2");
+        return static_cast<int>(jl_unbox_int64(ret));
+    }, TaskAffinity::kAnyWorker);
+    result.set_value(a + b);
+}
+
+DetachedCoroutine AwaitThrowingTask(JuliaExecutor& executor,
+                                    std::promise<std::string>& result) {
+    try {
+        co_await executor.SubmitAsync([]() -> int {
+            throw std::runtime_error("async failure");
+        });
+        result.set_value("no exception");
+    } catch (const std::runtime_error& e) {
+        result.set_value(e.what());
+    }
+}
+
+}  // namespace
+
+TEST_F(JuliaExecutorTest, SubmitAsyncGet) {
+    auto handle = executor_->SubmitAsync([]() { return 42; });
+    ASSERT_TRUE(handle.Valid());
+    EXPECT_EQ(handle.Get(), 42);
+}
+
+TEST_F(JuliaExecutorTest, SubmitAsyncDoesNotBlockCaller) {
+    std::atomic<bool> release{false};
+    auto handle = executor_->SubmitAsync([&release]() {
+        while (!release) {
+            std::this_thread::sleep_for(1ms);
+        }
+        return std::string("done");
+    });
+
+    // We got here while the task is still running
+    EXPECT_FALSE(handle.Ready());
+    release = true;
+    EXPECT_EQ(handle.Get(), "done");
+    EXPECT_TRUE(handle.Ready());
+}
+
+TEST_F(JuliaExecutorTest, SubmitAsyncPropagatesException) {
+    auto handle = executor_->SubmitAsync([]() -> int {
+        throw std::runtime_error("Test exception");
+    });
+    EXPECT_THROW(handle.Get(), std::runtime_error);
+}
+
+TEST_F(JuliaExecutorTest, SubmitAsyncOnComplete) {
+    std::promise<int> promise;
+    auto future = promise.get_future();
+
+    auto handle = executor_->SubmitAsync([]() { return 7; });
+    handle.OnComplete([&promise, handle]() mutable {
+        promise.set_value(handle.Get() * 6);
+    });
+
+    ASSERT_EQ(future.wait_for(5s), std::future_status::ready);
+    EXPECT_EQ(future.get(), 42);
+}
+
+TEST_F(JuliaExecutorTest, SubmitAsyncOnCompleteAfterCompletion) {
+    auto handle = executor_->SubmitAsync([]() { return 1; });
+    while (!handle.Ready()) {
+        std::this_thread::yield();
+    }
+
+    // Already finished: callback runs right here
+    bool called = false;
+    handle.OnComplete([&called]() { called = true; });
+    EXPECT_TRUE(called);
+}
+
+TEST_F(JuliaExecutorTest, OnCompleteExceptionIsReportedThroughHandle) {
+    std::atomic<bool> gate{false};
+    auto handle = executor_->SubmitAsync([&gate]() {
+        while (!gate.load()) {
+            std::this_thread::yield();
+        }
+        return 1;
+    });
+    handle.OnComplete([]() { throw std::runtime_error("callback failed"); });
+    gate.store(true);
+
+    // The callback threw on the worker, which keeps serving tasks
+    EXPECT_EQ(executor_->Submit([]() { return 2; }), 2);
+    ASSERT_NE(handle.CallbackException(), nullptr);
+    EXPECT_THROW(std::rethrow_exception(handle.CallbackException()),
+                 std::runtime_error);
+
+    // Already finished: the exception does not reach the caller either
+    auto done = executor_->SubmitAsync([]() { return 3; });
+    EXPECT_EQ(done.Get(), 3);
+    EXPECT_NO_THROW(done.OnComplete([]() { throw std::runtime_error("late"); }));
+    EXPECT_NE(done.CallbackException(), nullptr);
+}
+
+TEST_F(JuliaExecutorTest, CoAwaitSubmitAsync) {
+    std::promise<int> result;
+    auto future = result.get_future();
+
+    AwaitTwoTasks(*executor_, result);
+
+    ASSERT_EQ(future.wait_for(5s), std::future_status::ready);
+    EXPECT_EQ(future.get(), 42);
+}
+
+TEST_F(JuliaExecutorTest, CoAwaitPropagatesException) {
+    std::promise<std::string> result;
+    auto future = result.get_future();
+
+    AwaitThrowingTask(*executor_, result);
+
+    ASSERT_EQ(future.wait_for(5s), std::future_status::ready);
+    EXPECT_EQ(future.get(), "async failure");
+}
+
 // Tests with Variables and Partials
 
 TEST_F(JuliaExecutorTest, SubmitTaskReturningVariables) {
@@ -446,6 +810,73 @@ TEST_F(JuliaExecutorTest, SubmitTaskWithLargeDataStructure) {
     EXPECT_DOUBLE_EQ(result[large_size - 1], static_cast<double>(large_size - 1));
 }
 
+// GC policy tests
+
+TEST_F(JuliaExecutorTest, CollectionsAreCountedInsideAndOutsideTasks) {
+    GCCounts before = JuliaExecutor::CollectionCounts();
+    executor_->Submit([]() { jl_gc_collect(JL_GC_INCREMENTAL); });
+    GCCounts after = JuliaExecutor::CollectionCounts();
+    EXPECT_EQ(after.during_tasks, before.during_tasks + 1);
+    EXPECT_EQ(after.idle, before.idle);
+}
+
+TEST_F(JuliaExecutorTest, DeferredTasksRunWithGCDisabled) {
+    GCPolicy policy;
+    policy.defer_in_tasks = true;
+    EXPECT_THROW(executor_->SetGCPolicy(policy), std::runtime_error);
+
+    policy.full_threshold_bytes = size_t(1) << 40;
+    executor_->SetGCPolicy(policy);
+    int enabled_in_task = executor_->Submit([]() { return jl_gc_is_enabled(); });
+
+    // A throwing task restores GC and leaves its worker running
+    EXPECT_THROW(executor_->Submit([]() -> int {
+                     throw std::runtime_error("deferred failure");
+                 }),
+                 std::runtime_error);
+    executor_->Post([]() { throw std::runtime_error("posted failure"); });
+    executor_->SetGCPolicy(GCPolicy());
+
+    EXPECT_EQ(enabled_in_task, 0);
+    EXPECT_EQ(executor_->Submit([]() { return jl_gc_is_enabled(); }), 1);
+}
+
+TEST_F(JuliaExecutorTest, IdleExecutorCollects) {
+    GCPolicy policy;
+    policy.idle_interval = 20ms;
+    executor_->SetGCPolicy(policy);
+    EXPECT_EQ(executor_->GetGCPolicy().idle_interval, 20ms);
+
+    GCCounts before = JuliaExecutor::CollectionCounts();
+    executor_->Submit([]() { return 0; });
+    std::this_thread::sleep_for(300ms);
+    GCCounts after = JuliaExecutor::CollectionCounts();
+
+    // One collection per idle period, however many workers ran tasks
+    EXPECT_EQ(after.idle, before.idle + 1);
+    EXPECT_GE(after.outside_tasks, before.outside_tasks + 1);
+
+    // Tasks still wake a worker parked with an idle deadline
+    executor_->Submit([]() { return 0; });
+    EXPECT_EQ(executor_->Submit([]() { return 7; }), 7);
+    executor_->SetGCPolicy(GCPolicy());
+}
+
+TEST_F(JuliaExecutorTest, IdleCollectionIsFullAboveThreshold) {
+    GCPolicy policy;
+    policy.idle_interval = 20ms;
+    policy.full_threshold_bytes = 1;  // Any live data
+    executor_->SetGCPolicy(policy);
+
+    GCCounts before = JuliaExecutor::CollectionCounts();
+    executor_->Submit([]() { return 0; });
+    std::this_thread::sleep_for(300ms);
+    GCCounts after = JuliaExecutor::CollectionCounts();
+    executor_->SetGCPolicy(GCPolicy());
+
+    EXPECT_EQ(after.idle_full, before.idle_full + 1);
+}
+
 }  // namespace test
 }  // namespace julia
 }  // namespace philote
@@ -0,0 +1,116 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "julia_executor.h"
+#include "julia_gc.h"
+#include "test_helpers.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+namespace {
+
+// A fresh Julia string no global references
+jl_value_t* MakeString(size_t i) {
+    return jl_cstr_to_string(("root_" + std::to_string(i)).c_str());
+}
+
+bool HoldsString(jl_value_t* value, size_t i) {
+    return value && jl_is_string(value) &&
+           std::string(jl_string_ptr(value)) == "root_" + std::to_string(i);
+}
+
+}  // namespace
+
+class JuliaGCTest : public JuliaTestFixture {};
+
+TEST_F(JuliaGCTest, FrameRootsSurviveCollection) {
+    bool ok = JuliaExecutor::GetInstance().Submit([]() {
+        jl_gcframe_t* before = jl_pgcstack;
+        bool survived;
+        {
+            GCFrame<3> frame;
+            EXPECT_EQ(frame[2], nullptr);
+            for (size_t i = 0; i < frame.size(); ++i) {
+                frame.Set(i, MakeString(i));
+            }
+            jl_gc_collect(JL_GC_FULL);
+            survived = HoldsString(frame[0], 0) && HoldsString(frame[1], 1) &&
+                       HoldsString(frame[2], 2);
+        }
+        return survived && jl_pgcstack == before;
+    });
+    EXPECT_TRUE(ok);
+}
+
+TEST_F(JuliaGCTest, NestedFramesUnwindInOrder) {
+    bool ok = JuliaExecutor::GetInstance().Submit([]() {
+        jl_gcframe_t* before = jl_pgcstack;
+        bool survived;
+        {
+            GCFrame<1> outer(MakeString(0));
+            {
+                GCArenaFrame arena(10);
+                GCProtect protect({MakeString(1), MakeString(2)});
+                arena.Set(9, MakeString(9));
+                jl_gc_collect(JL_GC_FULL);
+                survived = HoldsString(arena[9], 9);
+            }
+            jl_gc_collect(JL_GC_FULL);
+            survived = survived && HoldsString(outer[0], 0);
+        }
+        return survived && jl_pgcstack == before;
+    });
+    EXPECT_TRUE(ok);
+}
+
+TEST_F(JuliaGCTest, ArenaFramesLargerThanAChunk) {
+    bool ok = JuliaExecutor::GetInstance().Submit([]() {
+        jl_gcframe_t* before = jl_pgcstack;
+        bool survived = true;
+        for (size_t n : {5000, 3, 5000}) {
+            GCArenaFrame small(7);
+            GCArenaFrame large(n);
+            for (size_t i = 0; i < n; ++i) {
+                large.Set(i, MakeString(i));
+            }
+            jl_gc_collect(JL_GC_FULL);
+            for (size_t i = 0; i < n; ++i) {
+                survived = survived && HoldsString(large[i], i);
+            }
+        }
+        return survived && jl_pgcstack == before;
+    });
+    EXPECT_TRUE(ok);
+}
+
+TEST_F(JuliaGCTest, GCProtectRootsMoreThanInline) {
+    bool ok = JuliaExecutor::GetInstance().Submit([]() {
+        jl_gcframe_t* before = jl_pgcstack;
+        bool survived;
+        {
+            jl_value_t* values[6];
+            for (size_t i = 0; i < 6; ++i) {
+                values[i] = MakeString(i);
+            }
+            GCProtect protect({values[0], values[1], values[2], values[3],
+                               values[4], values[5]});
+            jl_gc_collect(JL_GC_FULL);
+            survived = true;
+            for (size_t i = 0; i < 6; ++i) {
+                survived = survived && HoldsString(values[i], i);
+            }
+        }
+        return survived && jl_pgcstack == before;
+    });
+    EXPECT_TRUE(ok);
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
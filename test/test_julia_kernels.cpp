@@ -0,0 +1,134 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "julia_kernels.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+namespace {
+
+std::vector<double> Iota(size_t size) {
+    std::vector<double> values(size);
+    for (size_t i = 0; i < size; ++i) {
+        values[i] = static_cast<double>(i);
+    }
+    return values;
+}
+
+// The converter must agree with the generic runtime-rank conversion both ways
+void ExpectMatchesGeneric(const std::vector<size_t>& shape) {
+    ArrayConverter converter(shape, ArrayLayout::kRowMajor);
+    std::vector<double> src = Iota(converter.size());
+
+    std::vector<double> expected(src.size());
+    RowMajorToColumnMajor(src.data(), expected.data(), shape);
+    std::vector<double> column_major(src.size(), -1.0);
+    converter.ToJulia(src.data(), column_major.data());
+    EXPECT_EQ(column_major, expected);
+
+    std::vector<double> row_major(src.size(), -1.0);
+    converter.FromJulia(column_major.data(), row_major.data());
+    EXPECT_EQ(row_major, src);
+}
+
+}  // namespace
+
+TEST(JuliaKernelsTest, EachRankMatchesGeneric) {
+    ExpectMatchesGeneric({7});
+    ExpectMatchesGeneric({37, 53});
+    ExpectMatchesGeneric({33, 9, 70});
+    ExpectMatchesGeneric({2, 3, 4, 5});
+    ExpectMatchesGeneric({3, 2, 4, 5, 2});  // Above kMaxKernelRank
+}
+
+TEST(JuliaKernelsTest, SingletonDimensionsLowerTheRank) {
+    ArrayConverter vector({1, 9, 1}, ArrayLayout::kRowMajor);
+    EXPECT_EQ(vector.rank(), 0u);
+    EXPECT_TRUE(vector.julia_order());
+
+    ArrayConverter matrix({5, 1, 6}, ArrayLayout::kRowMajor);
+    EXPECT_EQ(matrix.rank(), 2u);
+    EXPECT_FALSE(matrix.julia_order());
+    ExpectMatchesGeneric({5, 1, 6});
+    ExpectMatchesGeneric({2, 1, 3, 1, 4});
+}
+
+TEST(JuliaKernelsTest, ColumnMajorIsCopied) {
+    ArrayConverter converter({2, 3}, ArrayLayout::kColumnMajor);
+    EXPECT_TRUE(converter.julia_order());
+
+    std::vector<double> src = Iota(6);
+    std::vector<double> dst(6);
+    converter.ToJulia(src.data(), dst.data());
+    EXPECT_EQ(dst, src);
+    converter.FromJulia(src.data(), dst.data());
+    EXPECT_EQ(dst, src);
+}
+
+TEST(JuliaKernelsTest, EmptyConverterCopiesNothing) {
+    double src = 1.0;
+    double dst = -1.0;
+    ArrayConverter().ToJulia(&src, &dst);
+    ArrayConverter({0, 4}, ArrayLayout::kRowMajor).ToJulia(&src, &dst);
+    EXPECT_EQ(dst, -1.0);
+}
+
+TEST(JuliaKernelsTest, ReverseAxesConvertsElementType) {
+    // Row-major {2, 3}: [[0, 1, 2], [3, 4, 5]] -> Julia [0, 3, 1, 4, 2, 5]
+    std::vector<double> src = Iota(6);
+    std::vector<float> dst(6);
+    size_t dims[2] = {2, 3};
+    ReverseAxes<2>(src.data(), dst.data(), dims);
+    EXPECT_EQ(dst, (std::vector<float>{0.0f, 3.0f, 1.0f, 4.0f, 2.0f, 5.0f}));
+
+    std::vector<double> back(6);
+    size_t reversed[2] = {3, 2};
+    ReverseAxes<2>(dst.data(), back.data(), reversed);
+    EXPECT_EQ(back, src);
+}
+
+TEST(JuliaKernelsTest, Float32IsNarrowedAndWidened) {
+    for (const std::vector<size_t>& shape :
+         std::vector<std::vector<size_t>>{{5}, {3, 4}, {2, 3, 4}, {2, 2, 3, 2, 2}}) {
+        ArrayConverter converter(shape, ArrayLayout::kRowMajor,
+                                 ElementType::kFloat32);
+        EXPECT_EQ(converter.element_type(), ElementType::kFloat32);
+        EXPECT_FALSE(converter.julia_order());
+
+        std::vector<double> src = Iota(converter.size());
+        std::vector<double> expected(src.size());
+        RowMajorToColumnMajor(src.data(), expected.data(), shape);
+
+        std::vector<float> column_major(src.size());
+        converter.ToJulia(src.data(), column_major.data());
+        for (size_t i = 0; i < src.size(); ++i) {
+            EXPECT_EQ(column_major[i], static_cast<float>(expected[i]));
+        }
+
+        std::vector<double> row_major(src.size(), -1.0);
+        converter.FromJulia(column_major.data(), row_major.data());
+        EXPECT_EQ(row_major, src);
+    }
+}
+
+TEST(JuliaKernelsTest, WithElementTypeKeepsTheShape) {
+    ArrayConverter converter({2, 3}, ArrayLayout::kRowMajor);
+    ArrayConverter single = converter.WithElementType(ElementType::kFloat32);
+    EXPECT_EQ(single.rank(), 2u);
+    EXPECT_EQ(single.size(), 6u);
+
+    std::vector<float> src = {0.0f, 3.0f, 1.0f, 4.0f, 2.0f, 5.0f};
+    std::vector<double> dst(6);
+    single.FromJulia(src.data(), dst.data());
+    EXPECT_EQ(dst, Iota(6));
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
@@ -0,0 +1,159 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "julia_layout.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+namespace {
+
+size_t Product(const std::vector<size_t>& shape) {
+    size_t size = 1;
+    for (size_t dim : shape) {
+        size *= dim;
+    }
+    return size;
+}
+
+// Element-by-element reference: unravel each row-major offset and ravel it
+// again in column-major order
+std::vector<double> ReferenceColumnMajor(const std::vector<double>& src,
+                                         const std::vector<size_t>& shape) {
+    std::vector<double> dst(src.size());
+    std::vector<size_t> index(shape.size());
+    for (size_t offset = 0; offset < src.size(); ++offset) {
+        size_t rest = offset;
+        for (size_t k = shape.size(); k-- > 0;) {
+            index[k] = rest % shape[k];
+            rest /= shape[k];
+        }
+        size_t jl_offset = 0;
+        size_t stride = 1;
+        for (size_t k = 0; k < shape.size(); ++k) {
+            jl_offset += index[k] * stride;
+            stride *= shape[k];
+        }
+        dst[jl_offset] = src[offset];
+    }
+    return dst;
+}
+
+void ExpectMatchesReference(const std::vector<size_t>& shape) {
+    std::vector<double> src(Product(shape));
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<double>(i);
+    }
+
+    std::vector<double> column_major(src.size(), -1.0);
+    RowMajorToColumnMajor(src.data(), column_major.data(), shape);
+    EXPECT_EQ(column_major, ReferenceColumnMajor(src, shape));
+
+    std::vector<double> row_major(src.size(), -1.0);
+    ColumnMajorToRowMajor(column_major.data(), row_major.data(), shape);
+    EXPECT_EQ(row_major, src);
+}
+
+}  // namespace
+
+TEST(JuliaLayoutTest, VectorIsCopied) {
+    ExpectMatchesReference({7});
+}
+
+TEST(JuliaLayoutTest, MatrixIsTransposed) {
+    // Row-major {2, 3}: [[1, 2, 3], [4, 5, 6]] -> Julia [1, 4, 2, 5, 3, 6]
+    std::vector<double> src = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    std::vector<double> dst(6);
+    RowMajorToColumnMajor(src.data(), dst.data(), {2, 3});
+    EXPECT_EQ(dst, (std::vector<double>{1.0, 4.0, 2.0, 5.0, 3.0, 6.0}));
+}
+
+TEST(JuliaLayoutTest, MatrixEdgesOutsideTiles) {
+    // Neither dimension is a multiple of the tile or block size
+    ExpectMatchesReference({37, 53});
+    ExpectMatchesReference({3, 70});
+    ExpectMatchesReference({65, 2});
+}
+
+TEST(JuliaLayoutTest, SingletonDimensionsIgnored) {
+    ExpectMatchesReference({1, 9});
+    ExpectMatchesReference({9, 1});
+    ExpectMatchesReference({5, 1, 6});
+    ExpectMatchesReference({1, 1, 1});
+}
+
+TEST(JuliaLayoutTest, ThreeDimensionalIsPermuted) {
+    ExpectMatchesReference({2, 3, 4});
+    ExpectMatchesReference({33, 9, 70});
+}
+
+TEST(JuliaLayoutTest, HigherRanksArePermuted) {
+    ExpectMatchesReference({2, 3, 4, 5});
+    ExpectMatchesReference({3, 2, 1, 4, 5});
+}
+
+TEST(JuliaLayoutTest, EmptyArrayIsNoOp) {
+    double dst = -1.0;
+    RowMajorToColumnMajor(nullptr, &dst, {0, 4});
+    EXPECT_EQ(dst, -1.0);
+}
+
+TEST(JuliaLayoutTest, StridedTranspose) {
+    // 5x6 sub-matrix of a 10x20 buffer into a 30x40 buffer
+    std::vector<double> src(10 * 20);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<double>(i);
+    }
+    std::vector<double> dst(30 * 40, -1.0);
+    TransposeMatrix(src.data(), 20, dst.data(), 40, 5, 6);
+
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 6; ++j) {
+            EXPECT_EQ(dst[j * 40 + i], src[i * 20 + j]);
+        }
+    }
+    EXPECT_EQ(dst[5], -1.0);  // Past the last source row
+}
+
+TEST(JuliaLayoutTest, ColumnMajorIsCopiedAsIs) {
+    std::vector<double> src = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    std::vector<double> dst(6);
+    CopyToJuliaOrder(src.data(), dst.data(), {2, 3}, ArrayLayout::kColumnMajor);
+    EXPECT_EQ(dst, src);
+
+    CopyFromJuliaOrder(src.data(), dst.data(), {2, 3}, ArrayLayout::kRowMajor);
+    EXPECT_EQ(dst, (std::vector<double>{1.0, 3.0, 5.0, 2.0, 4.0, 6.0}));
+}
+
+TEST(JuliaLayoutTest, ParseArrayLayout) {
+    EXPECT_EQ(ParseArrayLayout("row_major"), ArrayLayout::kRowMajor);
+    EXPECT_EQ(ParseArrayLayout("column_major"), ArrayLayout::kColumnMajor);
+    EXPECT_STREQ(ArrayLayoutName(ArrayLayout::kColumnMajor), "column_major");
+    EXPECT_THROW(ParseArrayLayout("fortran"), std::runtime_error);
+}
+
+TEST(JuliaLayoutTest, ElementTypesDefaultToFloat64) {
+    ArrayLayoutMap layouts(ArrayLayout::kColumnMajor);
+    EXPECT_FALSE(layouts.has_element_types());
+
+    layouts.SetElementType("u", ElementType::kFloat32);
+    EXPECT_EQ(layouts.GetElementType("u"), ElementType::kFloat32);
+    EXPECT_EQ(layouts.GetElementType("v"), ElementType::kFloat64);
+    EXPECT_EQ(layouts.Get("u"), ArrayLayout::kColumnMajor);
+    EXPECT_TRUE(layouts.has_element_types());
+
+    layouts.SetElementType("u", ElementType::kFloat64);
+    EXPECT_FALSE(layouts.has_element_types());
+    EXPECT_STREQ(ElementTypeName(ElementType::kFloat32), "Float32");
+    EXPECT_EQ(ElementSize(ElementType::kFloat32), 4u);
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
@@ -0,0 +1,151 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "julia_config.h"
+#include "julia_explicit_discipline.h"
+#include "julia_layout_service.h"
+#include "test_helpers.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+namespace {
+
+// Inputs x {3} and q {2, 2}, output J {4, 3}, partials dJ/dx and dJ/dq
+VariableLayoutsResponse Describe(const ArrayLayoutMap& layouts) {
+    std::vector<philote::VariableMetaData> vars = {
+        MakeMeta("x", philote::kInput, {3}),
+        MakeMeta("q", philote::kInput, {2, 2}),
+        MakeMeta("J", philote::kOutput, {4, 3})};
+    std::vector<philote::PartialsMetaData> partials = {MakePartial("J", "x"),
+                                                       MakePartial("J", "q")};
+    VariableLayoutsResponse response;
+    DescribeVariableLayouts(vars, partials, layouts, &response);
+    return response;
+}
+
+}  // namespace
+
+TEST(LayoutServiceTest, RowMajorByDefault) {
+    VariableLayoutsResponse response = Describe(ArrayLayoutMap());
+
+    ASSERT_EQ(response.inputs_size(), 2);
+    ASSERT_EQ(response.outputs_size(), 1);
+    ASSERT_EQ(response.partials_size(), 2);
+    for (const auto& entry : response.inputs()) {
+        EXPECT_EQ(entry.order(), VariableLayout::ROW_MAJOR);
+    }
+    EXPECT_EQ(response.outputs(0).order(), VariableLayout::ROW_MAJOR);
+    EXPECT_EQ(response.partials(0).order(), VariableLayout::ROW_MAJOR);
+}
+
+TEST(LayoutServiceTest, PartialShapeIsOutputThenInput) {
+    VariableLayoutsResponse response = Describe(ArrayLayoutMap());
+
+    const VariableLayout& partial = response.partials(1);
+    EXPECT_EQ(partial.name(), "J");
+    EXPECT_EQ(partial.subname(), "q");
+    ASSERT_EQ(partial.shape_size(), 4);
+    EXPECT_EQ(partial.shape(0), 4);
+    EXPECT_EQ(partial.shape(1), 3);
+    EXPECT_EQ(partial.shape(2), 2);
+    EXPECT_EQ(partial.shape(3), 2);
+}
+
+TEST(LayoutServiceTest, OverridesApplyPerVariableAndPartial) {
+    ArrayLayoutMap layouts(ArrayLayout::kColumnMajor);
+    layouts.Set("x", ArrayLayout::kRowMajor);
+    layouts.Set("J~q", ArrayLayout::kRowMajor);
+    VariableLayoutsResponse response = Describe(layouts);
+
+    for (const auto& entry : response.inputs()) {
+        EXPECT_EQ(entry.order(), entry.name() == "x"
+                                     ? VariableLayout::ROW_MAJOR
+                                     : VariableLayout::COLUMN_MAJOR)
+            << entry.name();
+    }
+    EXPECT_EQ(response.outputs(0).order(), VariableLayout::COLUMN_MAJOR);
+
+    // dJ/dx follows its output, dJ/dq has its own setting
+    EXPECT_EQ(response.partials(0).order(), VariableLayout::COLUMN_MAJOR);
+    EXPECT_EQ(response.partials(1).order(), VariableLayout::ROW_MAJOR);
+}
+
+// array_layout() as loaded from a discipline file; each test defines its
+// own type since every discipline shares Main
+class DisciplineArrayLayoutTest : public JuliaTestFixture {
+protected:
+    static std::shared_ptr<JuliaExplicitDiscipline> Load(
+        const std::string& source, const std::string& type) {
+        DisciplineConfig config;
+        config.kind = "explicit";
+        config.julia_file = CreateTempJuliaFile(source);
+        config.julia_type = type;
+        return std::make_shared<JuliaExplicitDiscipline>(config);
+    }
+};
+
+TEST_F(DisciplineArrayLayoutTest, ColumnMajorVariableReachesCompute) {
+    auto discipline = Load(R"(
+mutable struct ColumnMajorLayoutDiscipline
+    inputs::Dict{String,Tuple{Vector{Int},String}}
+    outputs::Dict{String,Tuple{Vector{Int},String}}
+    ColumnMajorLayoutDiscipline() = new(Dict(), Dict())
+end
+function setup!(d::ColumnMajorLayoutDiscipline)
+    d.inputs["A"] = ([2, 3], "m")
+    d.outputs["f"] = ([1], "m")
+end
+array_layout(d::ColumnMajorLayoutDiscipline) = Dict("A" => "column_major")
+compute(d::ColumnMajorLayoutDiscipline, inputs) = Dict("f" => [inputs["A"][2, 1]])
+)",
+                           "ColumnMajorLayoutDiscipline");
+    static_cast<philote::Discipline&>(*discipline).Setup();
+
+    EXPECT_EQ(discipline->array_layouts().Get("A"), ArrayLayout::kColumnMajor);
+    EXPECT_EQ(discipline->array_layouts().Get("f"), ArrayLayout::kRowMajor);
+
+    // Flat data 0..5 read column-major: A[2, 1] is the second element
+    philote::Variables inputs;
+    inputs["A"] = philote::Variable(philote::kInput, {2, 3});
+    for (size_t i = 0; i < 6; ++i) {
+        inputs["A"](i) = static_cast<double>(i);
+    }
+    philote::Variables outputs;
+    outputs["f"] = philote::Variable(philote::kOutput, {1});
+    static_cast<philote::ExplicitDiscipline&>(*discipline)
+        .Compute(inputs, outputs);
+    EXPECT_DOUBLE_EQ(outputs["f"](0), 1.0);
+}
+
+TEST_F(DisciplineArrayLayoutTest, LayoutForUndeclaredVariableFailsSetup) {
+    auto discipline = Load(R"(
+mutable struct UnknownLayoutDiscipline
+    inputs::Dict{String,Tuple{Vector{Int},String}}
+    outputs::Dict{String,Tuple{Vector{Int},String}}
+    UnknownLayoutDiscipline() = new(Dict(), Dict())
+end
+function setup!(d::UnknownLayoutDiscipline)
+    d.inputs["x"] = ([1], "m")
+    d.outputs["f"] = ([1], "m")
+end
+array_layout(d::UnknownLayoutDiscipline) = Dict("nope" => :column_major)
+compute(d::UnknownLayoutDiscipline, inputs) = Dict("f" => inputs["x"])
+)",
+                           "UnknownLayoutDiscipline");
+
+    EXPECT_THROW(static_cast<philote::Discipline&>(*discipline).Setup(),
+                 std::runtime_error);
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
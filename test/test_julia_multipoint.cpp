@@ -0,0 +1,221 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "julia_config.h"
+#include "julia_multipoint_service.h"
+#include "test_helpers.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+using philote::Variable;
+using philote::Variables;
+
+namespace {
+
+// Inputs of the paraboloid-like test discipline: scalar x, 2x3 matrix A
+Variables MakeTemplates() {
+    Variables templates;
+    templates["x"] = Variable(philote::kInput, {1});
+    templates["A"] = Variable(philote::kInput, {2, 3});
+    return templates;
+}
+
+// Point-major stacked input: value = 100 * point + index
+StackedVariable* AddStacked(MultiPointRequest& request, const std::string& name,
+                            const std::vector<int64_t>& shape, int num_points) {
+    StackedVariable* input = request.add_inputs();
+    input->set_name(name);
+    int64_t size = 1;
+    for (int64_t dim : shape) {
+        input->add_shape(dim);
+        size *= dim;
+    }
+    for (int j = 0; j < num_points; ++j) {
+        for (int64_t i = 0; i < size; ++i) {
+            input->add_data(100.0 * j + static_cast<double>(i));
+        }
+    }
+    return input;
+}
+
+MultiPointRequest MakeRequest(int num_points) {
+    MultiPointRequest request;
+    request.set_num_points(num_points);
+    AddStacked(request, "x", {1}, num_points);
+    AddStacked(request, "A", {2, 3}, num_points);
+    return request;
+}
+
+}  // namespace
+
+TEST(MultiPointTest, UnpackSplitsPoints) {
+    std::vector<Variables> points =
+        UnpackMultiPointInputs(MakeRequest(3), MakeTemplates());
+
+    ASSERT_EQ(points.size(), 3u);
+    for (size_t j = 0; j < points.size(); ++j) {
+        EXPECT_DOUBLE_EQ(points[j]["x"](0), 100.0 * j);
+        ASSERT_EQ(points[j]["A"].Size(), 6u);
+        for (size_t i = 0; i < 6; ++i) {
+            EXPECT_DOUBLE_EQ(points[j]["A"](i), 100.0 * j + i);
+        }
+    }
+}
+
+TEST(MultiPointTest, UnpackZeroPoints) {
+    EXPECT_TRUE(UnpackMultiPointInputs(MakeRequest(0), MakeTemplates()).empty());
+}
+
+TEST(MultiPointTest, UnpackRejectsMissingInput) {
+    MultiPointRequest request;
+    request.set_num_points(1);
+    AddStacked(request, "x", {1}, 1);
+    EXPECT_THROW(UnpackMultiPointInputs(request, MakeTemplates()),
+                 std::runtime_error);
+}
+
+TEST(MultiPointTest, UnpackRejectsUnknownInput) {
+    MultiPointRequest request = MakeRequest(1);
+    AddStacked(request, "y", {1}, 1);
+    EXPECT_THROW(UnpackMultiPointInputs(request, MakeTemplates()),
+                 std::runtime_error);
+}
+
+TEST(MultiPointTest, UnpackRejectsWrongSize) {
+    MultiPointRequest request = MakeRequest(2);
+    request.set_num_points(3);
+    EXPECT_THROW(UnpackMultiPointInputs(request, MakeTemplates()),
+                 std::runtime_error);
+
+    MultiPointRequest bad_shape;
+    bad_shape.set_num_points(1);
+    AddStacked(bad_shape, "x", {1}, 1);
+    AddStacked(bad_shape, "A", {3, 3}, 1);
+    EXPECT_THROW(UnpackMultiPointInputs(bad_shape, MakeTemplates()),
+                 std::runtime_error);
+}
+
+TEST(MultiPointTest, PackStacksPoints) {
+    std::vector<Variables> outputs(2);
+    for (size_t j = 0; j < outputs.size(); ++j) {
+        outputs[j]["f"] = Variable(philote::kOutput, {2});
+        outputs[j]["f"](0) = 10.0 * j;
+        outputs[j]["f"](1) = 10.0 * j + 1.0;
+    }
+
+    MultiPointResponse response;
+    PackMultiPointOutputs(outputs, &response);
+
+    EXPECT_EQ(response.num_points(), 2u);
+    ASSERT_EQ(response.outputs_size(), 1);
+    const StackedVariable& f = response.outputs(0);
+    EXPECT_EQ(f.name(), "f");
+    ASSERT_EQ(f.shape_size(), 1);
+    EXPECT_EQ(f.shape(0), 2);
+    std::vector<double> data(f.data().begin(), f.data().end());
+    EXPECT_EQ(data, (std::vector<double>{0.0, 1.0, 10.0, 11.0}));
+}
+
+TEST(MultiPointTest, PackRejectsMismatchedPoints) {
+    std::vector<Variables> outputs(2);
+    outputs[0]["f"] = Variable(philote::kOutput, {2});
+    outputs[1]["f"] = Variable(philote::kOutput, {3});
+
+    MultiPointResponse response;
+    EXPECT_THROW(PackMultiPointOutputs(outputs, &response), std::runtime_error);
+}
+
+// Discipline-level tests: evaluate points through Julia
+
+class MultiPointDisciplineTest : public JuliaTestFixture {
+protected:
+    static std::shared_ptr<JuliaExplicitDiscipline> LoadDiscipline(
+        const std::string& file, const std::string& type) {
+        DisciplineConfig config;
+        config.kind = "explicit";
+        config.julia_file = GetTestDisciplinePath(file);
+        config.julia_type = type;
+        auto discipline = std::make_shared<JuliaExplicitDiscipline>(config);
+        // Through the base class, as Philote's DisciplineServer calls it
+        static_cast<philote::Discipline&>(*discipline).Setup();
+        return discipline;
+    }
+
+    // Points (x, y) = (j, 2j), j = 0 .. num_points - 1
+    static std::vector<Variables> MakePoints(size_t num_points) {
+        std::vector<Variables> points(num_points);
+        for (size_t j = 0; j < num_points; ++j) {
+            points[j]["x"] = Variable(philote::kInput, {1});
+            points[j]["y"] = Variable(philote::kInput, {1});
+            points[j]["x"](0) = static_cast<double>(j);
+            points[j]["y"](0) = 2.0 * static_cast<double>(j);
+        }
+        return points;
+    }
+};
+
+TEST_F(MultiPointDisciplineTest, ComputeMultiPointThroughComputeBatch) {
+    // The paraboloid defines compute_batch
+    auto discipline = LoadDiscipline("paraboloid.jl", "ParaboloidDiscipline");
+
+    std::vector<Variables> outputs = discipline->ComputeMultiPoint(MakePoints(4));
+
+    ASSERT_EQ(outputs.size(), 4u);
+    for (size_t j = 0; j < outputs.size(); ++j) {
+        double x = static_cast<double>(j);
+        EXPECT_DOUBLE_EQ(outputs[j].at("f")(0), x * x + 4.0 * x * x);
+    }
+    EXPECT_TRUE(discipline->ComputeMultiPoint({}).empty());
+}
+
+TEST_F(MultiPointDisciplineTest, ComputeMultiPointLoopsCompute) {
+    // No compute_batch: one compute call per point
+    auto discipline = LoadDiscipline("multi_output.jl", "MultiOutputDiscipline");
+
+    std::vector<Variables> outputs = discipline->ComputeMultiPoint(MakePoints(3));
+
+    ASSERT_EQ(outputs.size(), 3u);
+    for (size_t j = 0; j < outputs.size(); ++j) {
+        double x = static_cast<double>(j);
+        EXPECT_DOUBLE_EQ(outputs[j].at("sum")(0), 3.0 * x);
+        EXPECT_DOUBLE_EQ(outputs[j].at("product")(0), 2.0 * x * x);
+        EXPECT_DOUBLE_EQ(outputs[j].at("difference")(0), -x);
+    }
+}
+
+TEST_F(MultiPointDisciplineTest, ServiceRejectsTooManyPoints) {
+    auto discipline = LoadDiscipline("paraboloid.jl", "ParaboloidDiscipline");
+    JuliaMultiPointService service(discipline, 2);
+
+    MultiPointRequest request;
+    request.set_num_points(3);
+    AddStacked(request, "x", {1}, 3);
+    AddStacked(request, "y", {1}, 3);
+    MultiPointResponse response;
+    grpc::Status status =
+        service.ComputeFunctionMultiPoint(nullptr, &request, &response);
+    EXPECT_EQ(status.error_code(), grpc::StatusCode::INVALID_ARGUMENT);
+
+    request.set_num_points(2);
+    request.clear_inputs();
+    AddStacked(request, "x", {1}, 2);
+    AddStacked(request, "y", {1}, 2);
+    status = service.ComputeFunctionMultiPoint(nullptr, &request, &response);
+    ASSERT_TRUE(status.ok()) << status.error_message();
+    EXPECT_EQ(response.num_points(), 2u);
+
+    EXPECT_THROW(JuliaMultiPointService(discipline, 0), std::runtime_error);
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
@@ -0,0 +1,233 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "julia_config.h"
+#include "julia_explicit_discipline.h"
+#include "julia_packed.h"
+#include "test_helpers.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+namespace {
+
+// Inputs z {1}, A {2, 3}, b {2}; output f {1}
+std::vector<philote::VariableMetaData> Vars() {
+    return {MakeMeta("z", philote::kInput, {1}),
+            MakeMeta("A", philote::kInput, {2, 3}),
+            MakeMeta("f", philote::kOutput, {1}),
+            MakeMeta("b", philote::kInput, {2})};
+}
+
+philote::Variables Inputs() {
+    philote::Variables inputs;
+    inputs["z"] = philote::Variable(philote::kInput, {1});
+    inputs["z"](0) = 9.0;
+    inputs["A"] = philote::Variable(philote::kInput, {2, 3});
+    for (size_t i = 0; i < 6; ++i) {
+        inputs["A"](i) = static_cast<double>(i + 1);  // [[1, 2, 3], [4, 5, 6]]
+    }
+    inputs["b"] = philote::Variable(philote::kInput, {2});
+    inputs["b"](0) = 7.0;
+    inputs["b"](1) = 8.0;
+    return inputs;
+}
+
+}  // namespace
+
+TEST(JuliaPackedTest, SlotsAreSortedAndContiguous) {
+    PackedIndex index = MakePackedIndex(Vars(), philote::kInput, ArrayLayoutMap());
+
+    ASSERT_EQ(index.slots.size(), 3u);
+    EXPECT_EQ(index.slots[0].name, "A");
+    EXPECT_EQ(index.slots[0].offset, 0u);
+    EXPECT_EQ(index.slots[1].name, "b");
+    EXPECT_EQ(index.slots[1].offset, 6u);
+    EXPECT_EQ(index.slots[2].name, "z");
+    EXPECT_EQ(index.slots[2].offset, 8u);
+    EXPECT_EQ(index.size, 9u);
+
+    PackedIndex outputs =
+        MakePackedIndex(Vars(), philote::kOutput, ArrayLayoutMap());
+    ASSERT_EQ(outputs.slots.size(), 1u);
+    EXPECT_EQ(outputs.size, 1u);
+}
+
+TEST(JuliaPackedTest, PackStoresJuliaOrder) {
+    PackedIndex index = MakePackedIndex(Vars(), philote::kInput, ArrayLayoutMap());
+    std::vector<double> buffer(index.size, -1.0);
+    PackVariables(Inputs(), index, buffer.data());
+
+    // A column-major, then b, then z
+    EXPECT_EQ(buffer, (std::vector<double>{1, 4, 2, 5, 3, 6, 7, 8, 9}));
+}
+
+TEST(JuliaPackedTest, UnpackRoundTrips) {
+    PackedIndex index = MakePackedIndex(Vars(), philote::kInput, ArrayLayoutMap());
+    std::vector<double> buffer(index.size);
+    philote::Variables inputs = Inputs();
+    PackVariables(inputs, index, buffer.data());
+
+    philote::Variables unpacked = UnpackVariables(buffer.data(), index);
+    ASSERT_EQ(unpacked.size(), 3u);
+    for (const auto& [name, var] : inputs) {
+        ASSERT_EQ(unpacked.at(name).Size(), var.Size()) << name;
+        for (size_t i = 0; i < var.Size(); ++i) {
+            EXPECT_EQ(unpacked.at(name)(i), var(i)) << name << " " << i;
+        }
+    }
+}
+
+TEST(JuliaPackedTest, ColumnMajorVariablesPackedAsIs) {
+    ArrayLayoutMap layouts;
+    layouts.Set("A", ArrayLayout::kColumnMajor);
+    PackedIndex index = MakePackedIndex(Vars(), philote::kInput, layouts);
+    std::vector<double> buffer(index.size);
+    PackVariables(Inputs(), index, buffer.data());
+
+    EXPECT_EQ(buffer[1], 2.0);
+}
+
+TEST(JuliaPackedTest, PackRejectsMismatchedVariables) {
+    PackedIndex index = MakePackedIndex(Vars(), philote::kInput, ArrayLayoutMap());
+    std::vector<double> buffer(index.size);
+
+    philote::Variables missing = Inputs();
+    missing.erase("b");
+    EXPECT_THROW(PackVariables(missing, index, buffer.data()),
+                 std::runtime_error);
+
+    philote::Variables extra = Inputs();
+    extra["zz"] = philote::Variable(philote::kInput, {1});
+    EXPECT_THROW(PackVariables(extra, index, buffer.data()), std::runtime_error);
+
+    philote::Variables resized = Inputs();
+    resized["b"] = philote::Variable(philote::kInput, {3});
+    EXPECT_THROW(PackVariables(resized, index, buffer.data()),
+                 std::runtime_error);
+}
+
+// compute_packed! as called by JuliaExplicitDiscipline::Compute
+class PackedDisciplineTest : public JuliaTestFixture {
+protected:
+    static std::shared_ptr<JuliaExplicitDiscipline> Load(
+        const std::string& julia_file, const std::string& type,
+        bool native_compute = true) {
+        DisciplineConfig config;
+        config.kind = "explicit";
+        config.julia_file = julia_file;
+        config.julia_type = type;
+        config.native_compute = native_compute;
+        auto discipline = std::make_shared<JuliaExplicitDiscipline>(config);
+        static_cast<philote::Discipline&>(*discipline).Setup();
+        return discipline;
+    }
+
+    static philote::Variables Compute(JuliaExplicitDiscipline& discipline,
+                                      const philote::Variables& inputs) {
+        philote::Variables outputs;
+        static_cast<philote::ExplicitDiscipline&>(discipline)
+            .Compute(inputs, outputs);
+        return outputs;
+    }
+};
+
+TEST_F(PackedDisciplineTest, NativeAndJlCallPathsAgree) {
+    philote::Variables inputs;
+    inputs["x"] = philote::Variable(philote::kInput, {1});
+    inputs["y"] = philote::Variable(philote::kInput, {1});
+    inputs["x"](0) = 3.0;
+    inputs["y"](0) = 4.0;
+
+    for (bool native : {true, false}) {
+        auto discipline = Load(GetTestDisciplinePath("packed_paraboloid.jl"),
+                               "PackedParaboloidDiscipline", native);
+        philote::Variables outputs = Compute(*discipline, inputs);
+        ASSERT_EQ(outputs.count("f"), 1u);
+        EXPECT_DOUBLE_EQ(outputs["f"](0), 25.0) << "native " << native;
+    }
+}
+
+TEST_F(PackedDisciplineTest, ThrowingComputePackedIsReported) {
+    std::string julia_file = CreateTempJuliaFile(R"(
+mutable struct ThrowingPackedDiscipline
+    inputs::Dict{String,Tuple{Vector{Int},String}}
+    outputs::Dict{String,Tuple{Vector{Int},String}}
+    ThrowingPackedDiscipline() = new(Dict(), Dict())
+end
+function setup!(d::ThrowingPackedDiscipline)
+    d.inputs["x"] = ([1], "m")
+    d.outputs["f"] = ([1], "m")
+end
+compute_packed!(d::ThrowingPackedDiscipline, x::Vector{Float64},
+                y::Vector{Float64}) = error("packed failure ✓")
+compute(d::ThrowingPackedDiscipline, inputs) = Dict("f" => inputs["x"])
+)");
+    philote::Variables inputs;
+    inputs["x"] = philote::Variable(philote::kInput, {1});
+
+    for (bool native : {true, false}) {
+        auto discipline = Load(julia_file, "ThrowingPackedDiscipline", native);
+        try {
+            Compute(*discipline, inputs);
+            ADD_FAILURE() << "compute_packed! error not raised, native "
+                          << native;
+        } catch (const std::runtime_error& e) {
+            EXPECT_NE(std::string(e.what()).find("packed failure"),
+                      std::string::npos)
+                << e.what();
+        }
+        // The worker survives and keeps serving
+        EXPECT_THROW(Compute(*discipline, inputs), std::runtime_error);
+    }
+}
+
+TEST_F(PackedDisciplineTest, SkippedOutputsReadAsZero) {
+    auto discipline = Load(CreateTempJuliaFile(R"(
+mutable struct SkippingPackedDiscipline
+    inputs::Dict{String,Tuple{Vector{Int},String}}
+    outputs::Dict{String,Tuple{Vector{Int},String}}
+    SkippingPackedDiscipline() = new(Dict(), Dict())
+end
+function setup!(d::SkippingPackedDiscipline)
+    d.inputs["x"] = ([1], "m")
+    d.outputs["f"] = ([1], "m")
+    d.outputs["g"] = ([1], "m")
+end
+# Packed in name order: f is outputs[1], g is outputs[2]
+function compute_packed!(d::SkippingPackedDiscipline, x::Vector{Float64},
+                         y::Vector{Float64})
+    if x[1] > 0
+        y[1] = x[1]
+    end
+    y[2] = 2 * x[1]
+    return nothing
+end
+compute(d::SkippingPackedDiscipline, inputs) =
+    Dict("f" => max.(inputs["x"], 0), "g" => 2 .* inputs["x"])
+)"),
+                           "SkippingPackedDiscipline");
+
+    philote::Variables inputs;
+    inputs["x"] = philote::Variable(philote::kInput, {1});
+    inputs["x"](0) = 3.0;
+    EXPECT_DOUBLE_EQ(Compute(*discipline, inputs)["f"](0), 3.0);
+
+    // f is left unwritten and must not repeat the previous request
+    inputs["x"](0) = -1.0;
+    philote::Variables outputs = Compute(*discipline, inputs);
+    EXPECT_DOUBLE_EQ(outputs["f"](0), 0.0);
+    EXPECT_DOUBLE_EQ(outputs["g"](0), -2.0);
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
@@ -0,0 +1,71 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "julia_partials.h"
+#include "test_helpers.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+namespace {
+
+std::vector<philote::VariableMetaData> Vars() {
+    return {MakeMeta("x", philote::kInput, {3}),
+            MakeMeta("a~b", philote::kInput, {1}),
+            MakeMeta("J", philote::kOutput, {2, 2}),
+            MakeMeta("f", philote::kOutput, {1})};
+}
+
+}  // namespace
+
+TEST(JuliaPartialsTest, TableIsSortedAndDeduplicated) {
+    // Declared twice, as Setup() and setup_partials!() both do
+    std::vector<philote::PartialsMetaData> partials = {
+        MakePartial("f", "x"), MakePartial("J", "x"), MakePartial("f", "x"),
+        MakePartial("J", "a~b")};
+    PartialsBlockTable table = MakePartialsBlockTable(
+        Vars(), partials, ArrayLayoutMap(), SparsityPatterns());
+
+    ASSERT_EQ(table.size(), 3u);
+    EXPECT_EQ(table[0].key, std::make_pair(std::string("J"), std::string("a~b")));
+    EXPECT_EQ(table[1].key, std::make_pair(std::string("J"), std::string("x")));
+    EXPECT_EQ(table[2].key, std::make_pair(std::string("f"), std::string("x")));
+}
+
+TEST(JuliaPartialsTest, BlocksCarryShapeLayoutAndPattern) {
+    ArrayLayoutMap layouts;
+    layouts.Set("J", ArrayLayout::kColumnMajor);
+    SparsityPatterns patterns;
+    auto pattern = std::make_shared<const SparsityPattern>();
+    patterns[{"f", "x"}] = pattern;
+
+    PartialsBlockTable table = MakePartialsBlockTable(
+        Vars(), {MakePartial("J", "x"), MakePartial("f", "x")}, layouts,
+        patterns);
+
+    ASSERT_EQ(table.size(), 2u);
+    EXPECT_EQ(table[0].shape, (std::vector<size_t>{2, 2, 3}));
+    EXPECT_EQ(table[0].size, 12u);
+    EXPECT_EQ(table[0].layout, ArrayLayout::kColumnMajor);
+    EXPECT_EQ(table[0].pattern, nullptr);
+    EXPECT_EQ(table[1].layout, ArrayLayout::kRowMajor);
+    EXPECT_EQ(table[1].pattern, pattern);
+}
+
+TEST(JuliaPartialsTest, UnknownVariableThrows) {
+    EXPECT_THROW(MakePartialsBlockTable(Vars(), {MakePartial("g", "x")},
+                                        ArrayLayoutMap(), SparsityPatterns()),
+                 std::runtime_error);
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
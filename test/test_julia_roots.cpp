@@ -0,0 +1,125 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "julia_executor.h"
+#include "julia_roots.h"
+#include "julia_runtime.h"
+#include "test_helpers.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+namespace {
+
+jl_value_t* MakeString(size_t i) {
+    return jl_cstr_to_string(("pooled_" + std::to_string(i)).c_str());
+}
+
+bool HoldsString(jl_value_t* value, size_t i) {
+    return value && jl_is_string(value) &&
+           std::string(jl_string_ptr(value)) == "pooled_" + std::to_string(i);
+}
+
+}  // namespace
+
+class JuliaRootsTest : public JuliaTestFixture {};
+
+TEST_F(JuliaRootsTest, RootsSurviveCollection) {
+    bool ok = JuliaExecutor::GetInstance().Submit([]() {
+        JuliaRoot root(MakeString(0));
+        jl_gc_collect(JL_GC_FULL);
+        return HoldsString(root.get(), 0);
+    });
+    EXPECT_TRUE(ok);
+}
+
+TEST_F(JuliaRootsTest, ReleasedSlotsAreReused) {
+    bool ok = JuliaExecutor::GetInstance().Submit([]() {
+        JuliaRootPool& pool = JuliaRuntime::GetInstance().Roots();
+        size_t held = pool.size();
+        size_t slot = pool.Acquire(MakeString(1));
+        bool counted = pool.size() == held + 1;
+        pool.Release(slot);
+        bool cleared = pool.Get(slot) == nullptr && pool.size() == held;
+        size_t again = pool.Acquire(MakeString(2));
+        bool reused = again == slot && HoldsString(pool.Get(again), 2);
+        pool.Release(again);
+        return counted && cleared && reused;
+    });
+    EXPECT_TRUE(ok);
+}
+
+TEST_F(JuliaRootsTest, MovedRootKeepsItsObject) {
+    bool ok = JuliaExecutor::GetInstance().Submit([]() {
+        JuliaRoot empty;
+        bool starts_empty = !empty && empty.get() == nullptr;
+
+        JuliaRoot first(MakeString(3));
+        JuliaRoot second(std::move(first));
+        bool moved = !first && HoldsString(second.get(), 3);
+
+        empty.Set(MakeString(4));
+        empty = std::move(second);
+        jl_gc_collect(JL_GC_FULL);
+        return starts_empty && moved && HoldsString(empty.get(), 3);
+    });
+    EXPECT_TRUE(ok);
+}
+
+TEST_F(JuliaRootsTest, PoolGrowsPastAChunk) {
+    bool ok = JuliaExecutor::GetInstance().Submit([]() {
+        size_t n = 3 * JuliaRootPool::kChunkSlots;
+        std::vector<JuliaRoot> roots;
+        for (size_t i = 0; i < n; ++i) {
+            roots.emplace_back(MakeString(i));
+        }
+        jl_gc_collect(JL_GC_FULL);
+        for (size_t i = 0; i < n; ++i) {
+            if (!HoldsString(roots[i].get(), i)) {
+                return false;
+            }
+        }
+        return true;
+    });
+    EXPECT_TRUE(ok);
+}
+
+TEST_F(JuliaRootsTest, ConcurrentGrowthWithCollections) {
+    // Both workers grow the pool while collecting; a chunk allocated under
+    // the pool's lock would leave the other worker unable to reach the
+    // collection's safepoint
+    auto grow = [](size_t first) {
+        size_t n = 2 * JuliaRootPool::kChunkSlots;
+        std::vector<JuliaRoot> roots;
+        for (size_t i = 0; i < n; ++i) {
+            roots.emplace_back(MakeString(first + i));
+            if (i % 64 == 0) {
+                jl_gc_collect(JL_GC_AUTO);
+            }
+        }
+        for (size_t i = 0; i < n; ++i) {
+            if (!HoldsString(roots[i].get(), first + i)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    JuliaExecutor& executor = JuliaExecutor::GetInstance();
+    auto a = executor.SubmitAsync([&]() { return grow(0); },
+                                  TaskAffinity::kAnyWorker);
+    auto b = executor.SubmitAsync([&]() { return grow(100000); },
+                                  TaskAffinity::kAnyWorker);
+    EXPECT_TRUE(a.Get());
+    EXPECT_TRUE(b.Get());
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
@@ -62,6 +62,40 @@ TEST_F(JuliaRuntimeTest, GetBaseModule) {
     EXPECT_TRUE(result);
 }
 
+// Handle cache tests
+
+TEST_F(JuliaRuntimeTest, HandlesPopulated) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        JuliaHandleCache& handles = JuliaRuntime::GetInstance().Handles();
+        return handles.setindex_fn ==
+                   jl_get_function(jl_base_module, "setindex!") &&
+               handles.vector_float64_type ==
+                   jl_apply_array_type(
+                       reinterpret_cast<jl_value_t*>(jl_float64_type), 1) &&
+               handles.dict_string_vector_type != nullptr &&
+               handles.dict_string_matrix_type != nullptr;
+    });
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(JuliaRuntimeTest, MainFunctionMemoizedUntilEval) {
+    auto result = JuliaExecutor::GetInstance().Submit([]() {
+        JuliaRuntime& runtime = JuliaRuntime::GetInstance();
+        JuliaHandleCache& handles = runtime.Handles();
+
+        // A miss is memoized until new code is evaluated into Main
+        if (handles.MainFunction("handle_cache_probe") != nullptr) return false;
+        runtime.EvalString("handle_cache_probe(x) = x + 1");
+        jl_function_t* fn = handles.MainFunction("handle_cache_probe");
+        if (!fn) return false;
+
+        return handles.MainFunction("handle_cache_probe") == fn;
+    });
+
+    EXPECT_TRUE(result);
+}
+
 // EvalString tests
 
 TEST_F(JuliaRuntimeTest, EvalStringSimpleArithmetic) {
@@ -0,0 +1,140 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "julia_sparse.h"
+#include "julia_sparse_service.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+namespace {
+
+// d(J {2, 2})/d(x {3}) with entries at Julia J[2,1] / x[3] and J[1,2] / x[1]
+SparsePartial MakeBlock(ArrayLayout layout) {
+    const int64_t rows[] = {2, 3};  // Linear indices of J[2,1] and J[1,2]
+    const int64_t cols[] = {3, 1};
+    SparsePartial block;
+    block.pattern = std::make_shared<const SparsityPattern>(
+        MakeSparsityPattern(rows, cols, 2, {2, 2}, {3}, layout));
+    block.values = {5.0, 7.0};
+    return block;
+}
+
+}  // namespace
+
+TEST(JuliaSparseTest, PatternInRowMajorOffsets) {
+    SparsePartial block = MakeBlock(ArrayLayout::kRowMajor);
+    const SparsityPattern& pattern = *block.pattern;
+
+    EXPECT_EQ(pattern.shape, (std::vector<size_t>{2, 2, 3}));
+    EXPECT_EQ(pattern.output_size, 4u);
+    EXPECT_EQ(pattern.input_size, 3u);
+    // J[2,1] is row-major offset 2, J[1,2] offset 1
+    EXPECT_EQ(pattern.rows, (std::vector<size_t>{2, 1}));
+    EXPECT_EQ(pattern.cols, (std::vector<size_t>{2, 0}));
+}
+
+TEST(JuliaSparseTest, PatternInColumnMajorOffsets) {
+    SparsePartial block = MakeBlock(ArrayLayout::kColumnMajor);
+    EXPECT_EQ(block.pattern->rows, (std::vector<size_t>{1, 2}));
+    EXPECT_EQ(block.pattern->cols, (std::vector<size_t>{2, 0}));
+}
+
+TEST(JuliaSparseTest, PatternRejectsOutOfRangeIndex) {
+    const int64_t rows[] = {5};
+    const int64_t cols[] = {1};
+    EXPECT_THROW(MakeSparsityPattern(rows, cols, 1, {2, 2}, {3},
+                                     ArrayLayout::kRowMajor),
+                 std::runtime_error);
+
+    const int64_t zero[] = {0};
+    EXPECT_THROW(MakeSparsityPattern(zero, cols, 1, {2, 2}, {3},
+                                     ArrayLayout::kRowMajor),
+                 std::runtime_error);
+}
+
+TEST(JuliaSparseTest, DensifyScattersIntoZeros) {
+    philote::Variable dense = DensifyPartial(MakeBlock(ArrayLayout::kRowMajor));
+
+    ASSERT_EQ(dense.Size(), 12u);
+    std::vector<double> expected(12, 0.0);
+    expected[2 * 3 + 2] = 5.0;  // (row 2, col 2)
+    expected[1 * 3 + 0] = 7.0;  // (row 1, col 0)
+    for (size_t i = 0; i < dense.Size(); ++i) {
+        EXPECT_EQ(dense(i), expected[i]) << i;
+    }
+}
+
+TEST(JuliaSparseTest, DensifyColumnMajor) {
+    philote::Variable dense =
+        DensifyPartial(MakeBlock(ArrayLayout::kColumnMajor));
+
+    std::vector<double> expected(12, 0.0);
+    expected[1 + 2 * 4] = 5.0;
+    expected[2 + 0 * 4] = 7.0;
+    for (size_t i = 0; i < dense.Size(); ++i) {
+        EXPECT_EQ(dense(i), expected[i]) << i;
+    }
+}
+
+TEST(JuliaSparseTest, DensifyRejectsWrongValueCount) {
+    SparsePartial block = MakeBlock(ArrayLayout::kRowMajor);
+    block.values.push_back(1.0);
+    EXPECT_THROW(DensifyPartial(block), std::runtime_error);
+}
+
+TEST(JuliaSparseTest, PackKeepsSparseBlocksSparse) {
+    philote::Partials dense;
+    dense[{"J", "q"}] = philote::Variable(philote::kOutput, {2, 2, 1});
+    SparsePartials sparse;
+    sparse[{"J", "x"}] = MakeBlock(ArrayLayout::kRowMajor);
+
+    SparseGradientResponse response;
+    PackSparseGradient(dense, sparse, &response);
+
+    ASSERT_EQ(response.partials_size(), 2);
+    const JacobianBlock& dense_block = response.partials(0);
+    EXPECT_EQ(dense_block.subname(), "q");
+    EXPECT_EQ(dense_block.rows_size(), 0);
+    EXPECT_EQ(dense_block.values_size(), 4);
+
+    const JacobianBlock& sparse_block = response.partials(1);
+    EXPECT_EQ(sparse_block.name(), "J");
+    EXPECT_EQ(sparse_block.subname(), "x");
+    EXPECT_EQ(sparse_block.shape_size(), 3);
+    ASSERT_EQ(sparse_block.values_size(), 2);
+    EXPECT_EQ(sparse_block.rows(0), 2);
+    EXPECT_EQ(sparse_block.cols(0), 2);
+    EXPECT_EQ(sparse_block.values(1), 7.0);
+}
+
+TEST(JuliaSparseTest, UnpackValidatesInputs) {
+    philote::Variables templates;
+    templates["x"] = philote::Variable(philote::kInput, {3});
+
+    SparseGradientRequest request;
+    FlatVariable* x = request.add_inputs();
+    x->set_name("x");
+    x->add_data(1.0);
+    x->add_data(2.0);
+    EXPECT_THROW(UnpackSparseGradientInputs(request, templates),
+                 std::runtime_error);
+
+    x->add_data(3.0);
+    philote::Variables inputs = UnpackSparseGradientInputs(request, templates);
+    EXPECT_EQ(inputs.at("x")(2), 3.0);
+
+    EXPECT_THROW(UnpackSparseGradientInputs(SparseGradientRequest(), templates),
+                 std::runtime_error);
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
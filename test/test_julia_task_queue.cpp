@@ -0,0 +1,113 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "julia_task_queue.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+TEST(MpscRingQueueTest, CapacityRoundsUpToPowerOfTwo) {
+    MpscRingQueue<int> queue(100);
+    EXPECT_EQ(queue.Capacity(), 128);
+}
+
+TEST(MpscRingQueueTest, PopFromEmptyFails) {
+    MpscRingQueue<int> queue(4);
+    int value = 0;
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_FALSE(queue.TryPop(value));
+}
+
+TEST(MpscRingQueueTest, FifoOrder) {
+    MpscRingQueue<int> queue(8);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(queue.TryPush(int(i)));
+    }
+    EXPECT_FALSE(queue.Empty());
+
+    for (int i = 0; i < 5; ++i) {
+        int value = -1;
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_TRUE(queue.Empty());
+}
+
+TEST(MpscRingQueueTest, PushToFullFailsWithoutConsumingValue) {
+    MpscRingQueue<std::unique_ptr<int>> queue(2);
+    EXPECT_TRUE(queue.TryPush(std::make_unique<int>(1)));
+    EXPECT_TRUE(queue.TryPush(std::make_unique<int>(2)));
+
+    auto extra = std::make_unique<int>(3);
+    EXPECT_FALSE(queue.TryPush(std::move(extra)));
+    ASSERT_NE(extra, nullptr);
+
+    std::unique_ptr<int> value;
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(*value, 1);
+    EXPECT_TRUE(queue.TryPush(std::move(extra)));
+}
+
+TEST(MpscRingQueueTest, WrapsAround) {
+    MpscRingQueue<int> queue(4);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(queue.TryPush(int(i)));
+        int value = -1;
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(MpscRingQueueTest, ManyProducersOneConsumer) {
+    constexpr int num_producers = 8;
+    constexpr int items_per_producer = 10000;
+    MpscRingQueue<int> queue(64);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < num_producers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < items_per_producer; ++i) {
+                int item = p * items_per_producer + i;
+                while (!queue.TryPush(int(item))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Items from one producer must come out in the order it pushed them
+    std::vector<int> last_seen(num_producers, -1);
+    int received = 0;
+    while (received < num_producers * items_per_producer) {
+        int value;
+        if (!queue.TryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        int producer = value / items_per_producer;
+        int index = value % items_per_producer;
+        EXPECT_GT(index, last_seen[producer]);
+        last_seen[producer] = index;
+        ++received;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.Empty());
+    for (int p = 0; p < num_producers; ++p) {
+        EXPECT_EQ(last_seen[p], items_per_producer - 1);
+    }
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote
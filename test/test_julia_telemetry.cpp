@@ -0,0 +1,216 @@
+// Copyright 2025 MDO Standards
+// Licensed under the Apache License, Version 2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "julia_executor.h"
+#include "julia_telemetry.h"
+#include "julia_telemetry_service.h"
+#include "test_helpers.h"
+
+namespace philote {
+namespace julia {
+namespace test {
+
+namespace {
+
+const MethodTelemetry* Find(const std::vector<MethodTelemetry>& methods,
+                            const std::string& name) {
+    for (const auto& method : methods) {
+        if (method.method == name) {
+            return &method;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+TEST(HistogramTest, EmptySnapshot) {
+    Histogram histogram;
+    HistogramSnapshot snapshot = histogram.Snapshot();
+    EXPECT_EQ(snapshot.count, 0u);
+    EXPECT_EQ(snapshot.max, 0u);
+    EXPECT_EQ(snapshot.Quantile(0.99), 0u);
+}
+
+TEST(HistogramTest, PowerOfTwoBuckets) {
+    Histogram histogram;
+    for (uint64_t value : {0u, 1u, 2u, 3u, 4u, 1000u}) {
+        histogram.Record(value);
+    }
+    HistogramSnapshot snapshot = histogram.Snapshot();
+    EXPECT_EQ(snapshot.count, 6u);
+    EXPECT_EQ(snapshot.sum, 1010u);
+    EXPECT_EQ(snapshot.max, 1000u);
+    EXPECT_EQ(snapshot.buckets[0], 1u);   // 0
+    EXPECT_EQ(snapshot.buckets[1], 1u);   // 1
+    EXPECT_EQ(snapshot.buckets[2], 2u);   // 2, 3
+    EXPECT_EQ(snapshot.buckets[3], 1u);   // 4
+    EXPECT_EQ(snapshot.buckets[10], 1u);  // 512 .. 1023
+    EXPECT_EQ(HistogramSnapshot::UpperBound(10), 1024u);
+}
+
+TEST(HistogramTest, QuantilesSeparateTheTail) {
+    Histogram histogram;
+    for (int i = 0; i < 990; ++i) {
+        histogram.Record(50'000);  // 50 us requests
+    }
+    for (int i = 0; i < 10; ++i) {
+        histogram.Record(5'000'000);  // 5 ms stalls
+    }
+    HistogramSnapshot snapshot = histogram.Snapshot();
+    EXPECT_GE(snapshot.Quantile(0.5), 50'000u);
+    EXPECT_LT(snapshot.Quantile(0.5), 100'000u);
+    EXPECT_EQ(snapshot.Quantile(0.999), 5'000'000u);  // Capped at max
+    EXPECT_EQ(snapshot.Quantile(1.0), 5'000'000u);
+}
+
+TEST(HistogramTest, ResetClears) {
+    Histogram histogram;
+    histogram.Record(7);
+    histogram.Reset();
+    HistogramSnapshot snapshot = histogram.Snapshot();
+    EXPECT_EQ(snapshot.count, 0u);
+    EXPECT_EQ(snapshot.sum, 0u);
+    EXPECT_EQ(snapshot.max, 0u);
+}
+
+TEST(TelemetryServiceTest, DescribesNonEmptyBuckets) {
+    MethodTelemetry method;
+    method.method = "compute";
+    method.wall_ns.count = 3;
+    method.wall_ns.sum = 12;
+    method.wall_ns.max = 6;
+    method.wall_ns.buckets[2] = 1;  // 2 .. 3
+    method.wall_ns.buckets[3] = 2;  // 4 .. 7
+    method.collections = 4;
+    method.calls_with_gc = 1;
+
+    RequestTelemetryResponse response;
+    DescribeRequestTelemetry({method}, &response);
+
+    ASSERT_EQ(response.methods_size(), 1);
+    const MethodRequestTelemetry& entry = response.methods(0);
+    EXPECT_EQ(entry.method(), "compute");
+    EXPECT_EQ(entry.wall_time_ns().count(), 3u);
+    EXPECT_EQ(entry.wall_time_ns().max(), 6u);
+    EXPECT_EQ(entry.wall_time_ns().p99(), 6u);
+    ASSERT_EQ(entry.wall_time_ns().buckets_size(), 2);
+    EXPECT_EQ(entry.wall_time_ns().buckets(0).upper_bound(), 4u);
+    EXPECT_EQ(entry.wall_time_ns().buckets(1).count(), 2u);
+    EXPECT_EQ(entry.gc_pause_ns().buckets_size(), 0);
+    EXPECT_EQ(entry.collections(), 4u);
+    EXPECT_EQ(entry.calls_with_gc(), 1u);
+}
+
+TEST(MethodStatsTest, OverlappedSamplesSkipJuliaCounters) {
+    MethodStats stats;
+    RequestSample alone;
+    alone.wall_ns = 10;
+    alone.allocated_bytes = 100;
+    alone.compile_ns = 5;
+    RequestSample overlapped = alone;
+    overlapped.overlapped = true;
+    overlapped.gc_pause_ns = 3;
+    overlapped.collections = 1;
+
+    stats.Record(alone);
+    stats.Record(overlapped);
+
+    EXPECT_EQ(stats.wall_ns.Snapshot().count, 2u);
+    EXPECT_EQ(stats.gc_pause_ns.Snapshot().count, 2u);
+    EXPECT_EQ(stats.calls_with_gc.load(), 1u);
+    EXPECT_EQ(stats.allocated_bytes.Snapshot().count, 1u);
+    EXPECT_EQ(stats.compile_ns.Snapshot().count, 1u);
+    EXPECT_EQ(stats.calls_compiling.load(), 1u);
+    EXPECT_EQ(stats.calls_overlapped.load(), 1u);
+}
+
+class JuliaTelemetryTest : public JuliaTestFixture {};
+
+TEST_F(JuliaTelemetryTest, ScopeRecordsAllocationsAndCollections) {
+    JuliaExecutor::GetInstance().Submit([]() {
+        TelemetryScope telemetry("test_allocating");
+        jl_eval_string("length([zeros(1000) for _ in 1:100])");
+        jl_gc_collect(JL_GC_AUTO);
+    });
+
+    const MethodTelemetry* method =
+        Find(RequestTelemetry::GetInstance().Snapshot(), "test_allocating");
+    ASSERT_NE(method, nullptr);
+    EXPECT_EQ(method->wall_ns.count, 1u);
+    EXPECT_GT(method->wall_ns.max, 0u);
+    EXPECT_GE(method->allocated_bytes.max, 100u * 1000u * sizeof(double));
+    EXPECT_GE(method->collections, 1u);
+    EXPECT_EQ(method->calls_with_gc, 1u);
+    EXPECT_EQ(method->calls_overlapped, 0u);
+}
+
+TEST_F(JuliaTelemetryTest, ScopeRecordsCompilation) {
+    JuliaExecutor::GetInstance().Submit([]() {
+        TelemetryScope telemetry("test_compiling");
+        jl_eval_string("telemetry_test_fn(x) = x * 2 + 1; telemetry_test_fn(3)");
+    });
+
+    const MethodTelemetry* method =
+        Find(RequestTelemetry::GetInstance().Snapshot(), "test_compiling");
+    ASSERT_NE(method, nullptr);
+    EXPECT_GT(method->compile_ns.max, 0u);
+    EXPECT_EQ(method->calls_compiling, 1u);
+}
+
+TEST_F(JuliaTelemetryTest, NestedScopesFoldIntoOutermost) {
+    JuliaExecutor::GetInstance().Submit([]() {
+        TelemetryScope outer("test_outer");
+        for (int i = 0; i < 3; ++i) {
+            TelemetryScope inner("test_inner");
+        }
+    });
+
+    auto methods = RequestTelemetry::GetInstance().Snapshot();
+    const MethodTelemetry* outer = Find(methods, "test_outer");
+    ASSERT_NE(outer, nullptr);
+    EXPECT_EQ(outer->wall_ns.count, 1u);
+    EXPECT_EQ(Find(methods, "test_inner"), nullptr);
+}
+
+TEST_F(JuliaTelemetryTest, ConcurrentScopesAreFlaggedOverlapped) {
+    // Two requests on the two test workers, each holding its scope open
+    // until the other has opened its own
+    MethodStats& stats =
+        RequestTelemetry::GetInstance().Method("test_overlapped");
+    std::atomic<int> entered{0};
+    auto request = [&]() {
+        TelemetryScope telemetry(stats);
+        entered.fetch_add(1);
+        auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (entered.load() < 2 &&
+               std::chrono::steady_clock::now() < deadline) {
+            jl_gc_safepoint();
+            std::this_thread::yield();
+        }
+        return entered.load() == 2;
+    };
+    JuliaExecutor& executor = JuliaExecutor::GetInstance();
+    auto a = executor.SubmitAsync(request, TaskAffinity::kAnyWorker);
+    auto b = executor.SubmitAsync(request, TaskAffinity::kAnyWorker);
+    ASSERT_TRUE(a.Get());
+    ASSERT_TRUE(b.Get());
+
+    EXPECT_EQ(stats.wall_ns.Snapshot().count, 2u);
+    EXPECT_EQ(stats.calls_overlapped.load(), 2u);
+    EXPECT_EQ(stats.allocated_bytes.Snapshot().count, 0u);
+    EXPECT_EQ(stats.compile_ns.Snapshot().count, 0u);
+}
+
+}  // namespace test
+}  // namespace julia
+}  // namespace philote